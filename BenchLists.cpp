@@ -0,0 +1,1196 @@
+#include <stdint.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <forward_list>
+#include <functional>
+#include <iterator>
+#include <list>
+#include <mutex>
+#include <numeric>
+#include <ranges>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "CompactLinkedList.hpp"
+#include "ConcurrentLinkedQueue.hpp"
+#include "DoublyLinkedList.hpp"
+#include "IndexedLinkedList.hpp"
+#include "IntrusiveLinkedList.hpp"
+#include "LinkedList.hpp"
+#include "ListStatistics.hpp"
+#include "ListViews.hpp"
+#include "MappedList.hpp"
+#include "PersistentList.hpp"
+#include "SkipList.hpp"
+#include "SlabAllocator.hpp"
+#include "SmallLinkedList.hpp"
+#include "StaticLinkedList.hpp"
+#include "UnrolledLinkedList.hpp"
+
+using namespace std;
+
+// Microbenchmark suite for the list family. Every benchmark is registered per
+// container and runs at each size from 10 to 10^7; the runner repeats it until
+// the measured time reaches --min-time and reports the mean cost of one
+// operation. Results are printed as a table, or as CSV/JSON for trend tracking.
+//
+//   ./benchlists [--format=table|csv|json] [--out=FILE] [--filter=TEXT]
+//                [--min-size=N] [--max-size=N] [--min-time=MS]
+
+//-----------------------------------------------------------------------------
+// Harness
+
+// Keeps the compiler from discarding a computed value.
+template <typename T>
+inline void doNotOptimize(const T& value) {
+  asm volatile("" : : "r,m"(value) : "memory");
+}
+
+class State {
+ public:
+  explicit State(const size_t size) : size(size), operations(0), nanoseconds(0) {}
+
+  // Times `body`, which performs `count` operations. Setup outside of it is
+  // not measured.
+  template <typename Function>
+  void measure(const size_t count, Function&& body) {
+    auto start = chrono::steady_clock::now();
+    body();
+    auto stop = chrono::steady_clock::now();
+    this->nanoseconds += chrono::duration<double, nano>(stop - start).count();
+    this->operations += count;
+  }
+
+  const size_t size;
+  size_t operations;
+  double nanoseconds;
+};
+
+struct Benchmark {
+  string name;
+  string container;
+  function<void(State&)> body;
+  size_t maxSize;
+};
+
+struct Result {
+  string name;
+  string container;
+  size_t size;
+  size_t repetitions;
+  size_t operations;
+  double nanosecondsPerOperation;
+};
+
+vector<Benchmark>& registry() {
+  static vector<Benchmark> benchmarks;
+  return benchmarks;
+}
+
+void registerBenchmark(const string& name, const string& container,
+                       function<void(State&)> body, const size_t maxSize = SIZE_MAX) {
+  registry().push_back(Benchmark{name, container, std::move(body), maxSize});
+}
+
+// Operations that cost O(n) on some container get a per-run budget that
+// shrinks with the size, so the largest sizes stay tractable.
+size_t linearBudget(const size_t size, const size_t most = 1000) {
+  return std::max<size_t>(1, std::min<size_t>(most, 10000000 / size));
+}
+
+uint32_t nextRandom(uint32_t& seed) {
+  seed = seed * 1103515245u + 12345u;
+  return seed >> 8;
+}
+
+//-----------------------------------------------------------------------------
+// Container adapters. The list family shares one API; the standard containers
+// are mapped onto it. std::forward_list is wrapped to keep an iterator to its
+// last element so that appending is O(1), as it is for LinkedList.
+
+// LinkedList counting its allocations and walks, to price the statistics.
+using CountedList = LinkedList<int, std::allocator<int>, ListStatistics>;
+
+template <typename T>
+struct TailedForwardList {
+  TailedForwardList() : last(list.before_begin()), count(0) {}
+  TailedForwardList(const TailedForwardList&) = delete;
+
+  forward_list<T> list;
+  typename forward_list<T>::iterator last;
+  size_t count;
+};
+
+template <typename List>
+void pushBack(List& list, const int data) { list.append(data); }
+template <typename T>
+void pushBack(std::list<T>& list, const int data) { list.push_back(data); }
+template <typename T>
+void pushBack(vector<T>& list, const int data) { list.push_back(data); }
+template <typename T>
+void pushBack(TailedForwardList<T>& list, const int data) {
+  list.last = list.list.insert_after(list.last, data);
+  ++list.count;
+}
+
+template <typename List>
+void pushFront(List& list, const int data) { list.prepend(data); }
+template <typename T>
+void pushFront(std::list<T>& list, const int data) { list.push_front(data); }
+template <typename T>
+void pushFront(vector<T>& list, const int data) { list.insert(list.begin(), data); }
+template <typename T>
+void pushFront(PersistentList<T>& list, const int data) { list = list.prepend(data); }
+template <typename T>
+void pushFront(TailedForwardList<T>& list, const int data) {
+  list.list.push_front(data);
+  if (list.count++ == 0) list.last = list.list.begin();
+}
+
+template <typename List>
+int popFront(List& list) { return list.unprepend(); }
+template <typename T>
+int popFront(std::list<T>& list) {
+  int data = list.front();
+  list.pop_front();
+  return data;
+}
+template <typename T>
+int popFront(PersistentList<T>& list) {
+  int data = list.getHead();
+  list = list.unprepend();
+  return data;
+}
+template <typename T>
+int popFront(TailedForwardList<T>& list) {
+  int data = list.list.front();
+  list.list.pop_front();
+  if (--list.count == 0) list.last = list.list.before_begin();
+  return data;
+}
+
+template <typename List>
+int popBack(List& list) { return list.unappend(); }
+template <typename T>
+int popBack(std::list<T>& list) {
+  int data = list.back();
+  list.pop_back();
+  return data;
+}
+template <typename T>
+int popBack(vector<T>& list) {
+  int data = list.back();
+  list.pop_back();
+  return data;
+}
+
+template <typename List>
+void insertAt(List& list, const size_t index, const int data) { list.insert(data, index); }
+template <typename T>
+void insertAt(std::list<T>& list, const size_t index, const int data) {
+  list.insert(next(list.begin(), index), data);
+}
+template <typename T>
+void insertAt(vector<T>& list, const size_t index, const int data) {
+  list.insert(list.begin() + index, data);
+}
+template <typename T>
+void insertAt(TailedForwardList<T>& list, const size_t index, const int data) {
+  auto position = list.list.insert_after(next(list.list.before_begin(), index), data);
+  if (index == list.count++) list.last = position;
+}
+
+template <typename List>
+int removeAt(List& list, const size_t index) { return list.remove(index); }
+template <typename T>
+int removeAt(std::list<T>& list, const size_t index) {
+  auto position = next(list.begin(), index);
+  int data = *position;
+  list.erase(position);
+  return data;
+}
+template <typename T>
+int removeAt(vector<T>& list, const size_t index) {
+  int data = list[index];
+  list.erase(list.begin() + index);
+  return data;
+}
+template <typename T>
+int removeAt(TailedForwardList<T>& list, const size_t index) {
+  auto before = next(list.list.before_begin(), index);
+  int data = *next(before);
+  list.list.erase_after(before);
+  if (index == --list.count) list.last = before;
+  return data;
+}
+
+template <typename List>
+int at(const List& list, const size_t index) { return list[index]; }
+template <typename T>
+int at(const std::list<T>& list, const size_t index) { return *next(list.begin(), index); }
+template <typename T>
+int at(const TailedForwardList<T>& list, const size_t index) {
+  return *next(list.list.begin(), index);
+}
+
+template <typename List>
+size_t sizeOf(const List& list) { return list.size(); }
+template <typename T>
+size_t sizeOf(const TailedForwardList<T>& list) { return list.count; }
+
+template <typename List>
+int64_t sum(const List& list) {
+  int64_t total = 0;
+  for (int data : list) total += data;
+  return total;
+}
+template <typename T>
+int64_t sum(const TailedForwardList<T>& list) {
+  int64_t total = 0;
+  for (int data : list.list) total += data;
+  return total;
+}
+
+template <typename List>
+bool has(const List& list, const int data) { return list.contains(data); }
+template <typename T>
+bool has(const std::list<T>& list, const int data) {
+  return find(list.begin(), list.end(), data) != list.end();
+}
+template <typename T>
+bool has(const vector<T>& list, const int data) {
+  return find(list.begin(), list.end(), data) != list.end();
+}
+template <typename T>
+bool has(const TailedForwardList<T>& list, const int data) {
+  return find(list.list.begin(), list.list.end(), data) != list.list.end();
+}
+
+template <typename List>
+size_t countOf(const List& list, const int data) {
+  return std::count(list.begin(), list.end(), typename List::value_type(data));
+}
+template <typename T, size_t N>
+size_t countOf(const UnrolledLinkedList<T, N>& list, const int data) { return list.count(data); }
+template <typename T>
+size_t countOf(const TailedForwardList<T>& list, const int data) {
+  return std::count(list.list.begin(), list.list.end(), data);
+}
+
+template <typename List>
+bool same(const List& a, const List& b) { return a == b; }
+template <typename T>
+bool same(const TailedForwardList<T>& a, const TailedForwardList<T>& b) {
+  return a.list == b.list;
+}
+
+template <typename List>
+void fill(List& list, const size_t count) {
+  for (size_t i = 0; i < count; ++i) pushBack(list, int(i));
+}
+// PersistentList::append copies the list, so build it from the back.
+template <typename T>
+void fill(PersistentList<T>& list, const size_t count) {
+  for (size_t i = count; i > 0; --i) pushFront(list, int(i - 1));
+}
+
+//-----------------------------------------------------------------------------
+// Benchmarks shared by every container
+
+template <typename List>
+void benchAppend(State& state) {
+  List list;
+  state.measure(state.size, [&] {
+    for (size_t i = 0; i < state.size; ++i) pushBack(list, int(i));
+  });
+  doNotOptimize(sizeOf(list));
+}
+
+template <typename List>
+void benchPrepend(State& state) {
+  List list;
+  state.measure(state.size, [&] {
+    for (size_t i = 0; i < state.size; ++i) pushFront(list, int(i));
+  });
+  doNotOptimize(sizeOf(list));
+}
+
+template <typename List>
+void benchInsert(State& state) {
+  List list;
+  fill(list, state.size);
+  const size_t count = linearBudget(state.size);
+  uint32_t seed = 1;
+  state.measure(count, [&] {
+    for (size_t i = 0; i < count; ++i)
+      insertAt(list, nextRandom(seed) % (sizeOf(list) + 1), int(i));
+  });
+  doNotOptimize(sizeOf(list));
+}
+
+template <typename List>
+void benchRemove(State& state) {
+  List list;
+  const size_t count = linearBudget(state.size);
+  fill(list, state.size + count);
+  uint32_t seed = 2;
+  int64_t total = 0;
+  state.measure(count, [&] {
+    for (size_t i = 0; i < count; ++i) total += removeAt(list, nextRandom(seed) % sizeOf(list));
+  });
+  doNotOptimize(total);
+}
+
+template <typename List>
+void benchIndex(State& state) {
+  List list;
+  fill(list, state.size);
+  const size_t count = linearBudget(state.size);
+  uint32_t seed = 3;
+  int64_t total = 0;
+  state.measure(count, [&] {
+    for (size_t i = 0; i < count; ++i) total += at(list, nextRandom(seed) % state.size);
+  });
+  doNotOptimize(total);
+}
+
+// Reported per element visited.
+template <typename List>
+void benchIterate(State& state) {
+  List list;
+  fill(list, state.size);
+  int64_t total = 0;
+  state.measure(state.size, [&] { total = sum(list); });
+  doNotOptimize(total);
+}
+
+// Searches for a missing value, so every call scans the whole container
+// unless it is indexed.
+template <typename List>
+void benchContains(State& state) {
+  List list;
+  fill(list, state.size);
+  const size_t count = linearBudget(state.size, 100);
+  size_t found = 0;
+  state.measure(count, [&] {
+    for (size_t i = 0; i < count; ++i) found += has(list, -1);
+  });
+  doNotOptimize(found);
+}
+
+// Counts a value present once per 7 elements. Reported per element scanned.
+template <typename List>
+void benchCount(State& state) {
+  List list;
+  for (size_t i = 0; i < state.size; ++i) pushBack(list, int(i % 7));
+  size_t found = 0;
+  state.measure(state.size, [&] { found = countOf(list, 3); });
+  doNotOptimize(found);
+}
+
+// Compares two equal containers. Reported per element compared.
+template <typename List>
+void benchEquality(State& state) {
+  List a, b;
+  fill(a, state.size);
+  fill(b, state.size);
+  bool equal = false;
+  state.measure(state.size, [&] { equal = same(a, b); });
+  doNotOptimize(equal);
+}
+
+template <typename List>
+void registerCommon(const string& container, const size_t prependMaxSize = SIZE_MAX) {
+  registerBenchmark("append", container, benchAppend<List>);
+  registerBenchmark("prepend", container, benchPrepend<List>, prependMaxSize);
+  registerBenchmark("insert", container, benchInsert<List>);
+  registerBenchmark("remove", container, benchRemove<List>);
+  registerBenchmark("index", container, benchIndex<List>);
+  registerBenchmark("iterate", container, benchIterate<List>);
+  registerBenchmark("contains", container, benchContains<List>);
+  registerBenchmark("equality", container, benchEquality<List>);
+}
+
+//-----------------------------------------------------------------------------
+// Benchmarks for specific container features
+
+// Queue-style churn: push at the back and pop at the front with `size`
+// elements resident. Dominated by node allocation.
+template <typename List>
+void benchChurn(State& state) {
+  List list;
+  fill(list, state.size);
+  const size_t count = 1000000;
+  int64_t total = 0;
+  state.measure(count, [&] {
+    for (size_t i = 0; i < count; ++i) {
+      pushBack(list, int(i));
+      total += popFront(list);
+    }
+  });
+  doNotOptimize(total);
+}
+
+// Creates, fills, sums and destroys many lists of six elements, the sizes most
+// lists have. Independent of the size; reported per list.
+template <typename List>
+void benchTinyLists(State& state) {
+  const size_t count = 100000;
+  int64_t total = 0;
+  state.measure(count, [&] {
+    for (size_t i = 0; i < count; ++i) {
+      List list;
+      for (int data = 0; data < 6; ++data) pushBack(list, data + int(i));
+      for (const int data : list) total += data;
+    }
+  });
+  doNotOptimize(total);
+}
+
+// Stack-style churn at the back, where LinkedList::unappend walks the chain.
+template <typename List>
+void benchUnappend(State& state) {
+  List list;
+  fill(list, state.size);
+  const size_t count = linearBudget(state.size, 100000);
+  int64_t total = 0;
+  state.measure(count, [&] {
+    for (size_t i = 0; i < count; ++i) {
+      pushBack(list, int(i));
+      total += popBack(list);
+    }
+  });
+  doNotOptimize(total);
+}
+
+// Legacy-style `for (i = 0; i < size(); ++i) list[i]` loop. Reported per
+// element visited.
+template <typename List>
+void benchIndexedLoop(State& state) {
+  List list;
+  fill(list, state.size);
+  int64_t total = 0;
+  state.measure(state.size, [&] {
+    for (size_t i = 0; i < sizeOf(list); ++i) total += at(list, i);
+  });
+  doNotOptimize(total);
+}
+
+// Moves a list of `size` elements onto the end of another.
+template <typename List>
+void benchSplice(State& state) {
+  List a, b;
+  fill(a, state.size);
+  fill(b, state.size);
+  state.measure(1, [&] { a.splice(std::move(b)); });
+  doNotOptimize(a.size());
+}
+template <>
+void benchSplice<std::list<int>>(State& state) {
+  std::list<int> a, b;
+  fill(a, state.size);
+  fill(b, state.size);
+  state.measure(1, [&] { a.splice(a.end(), b); });
+  doNotOptimize(a.size());
+}
+
+// Sorts `size` random values in place. Reported per element.
+template <typename List>
+void benchSort(State& state) {
+  List list;
+  uint32_t seed = 4;
+  for (size_t i = 0; i < state.size; ++i) pushBack(list, int(nextRandom(seed)));
+  state.measure(state.size, [&] { list.sort(); });
+  doNotOptimize(sizeOf(list));
+}
+
+// Sorting a LinkedList by copying into a vector and rebuilding the list.
+void benchSortThroughVector(State& state) {
+  LinkedList<int> list;
+  uint32_t seed = 4;
+  for (size_t i = 0; i < state.size; ++i) list.append(int(nextRandom(seed)));
+  state.measure(state.size, [&] {
+    vector<int> values(list.begin(), list.end());
+    std::sort(values.begin(), values.end());
+    list.clear();
+    for (int data : values) list.append(data);
+  });
+  doNotOptimize(list.size());
+}
+
+// Merges two interleaved sorted lists of `size` elements. Reported per
+// element of the result.
+template <typename List>
+void benchMerge(State& state) {
+  List a, b;
+  for (size_t i = 0; i < state.size; ++i) {
+    pushBack(a, int(2 * i));
+    pushBack(b, int(2 * i + 1));
+  }
+  state.measure(2 * state.size, [&] { a.merge(std::move(b)); });
+  doNotOptimize(sizeOf(a));
+}
+
+// Membership tests for random values, half of them present. Reported per
+// lookup.
+template <typename List>
+void benchLookup(State& state) {
+  List list;
+  fill(list, state.size);
+  const size_t count = 1000;
+  uint32_t seed = 5;
+  size_t found = 0;
+  state.measure(count, [&] {
+    for (size_t i = 0; i < count; ++i) found += has(list, int(nextRandom(seed) % (2 * state.size)));
+  });
+  doNotOptimize(found);
+}
+
+// Removes random values by value, each present once. Reported per removal.
+template <typename List>
+void benchRemoveValue(State& state) {
+  List list;
+  fill(list, state.size);
+  const size_t count = std::min<size_t>(state.size, 1000);
+  uint32_t seed = 6;
+  state.measure(count, [&] {
+    for (size_t i = 0; i < count; ++i) list.remove(int(nextRandom(seed) % state.size), 1);
+  });
+  doNotOptimize(sizeOf(list));
+}
+
+// Builds a duplicate-free list from `size` values drawn from size / 2
+// distinct ones, checking membership before every append. Reported per value.
+template <typename List>
+void benchDedup(State& state) {
+  List list;
+  uint32_t seed = 7;
+  state.measure(state.size, [&] {
+    for (size_t i = 0; i < state.size; ++i) {
+      int data = int(nextRandom(seed) % (state.size / 2 + 1));
+      if (!has(list, data)) pushBack(list, data);
+    }
+  });
+  doNotOptimize(sizeOf(list));
+}
+
+// Pooled object that can be linked intrusively.
+struct PoolObject {
+  int id;
+  IntrusiveHook hook;
+};
+
+// Objects live in a pool; the list tracks `size` of them. Each operation
+// removes a random object by reference and appends it again.
+void benchPoolChurnIntrusive(State& state) {
+  vector<PoolObject> pool(state.size);
+  IntrusiveLinkedList<PoolObject, &PoolObject::hook> list;
+  for (PoolObject& object : pool) list.append(object);
+  const size_t count = 100000;
+  uint32_t seed = 8;
+  state.measure(count, [&] {
+    for (size_t i = 0; i < count; ++i) {
+      PoolObject& object = pool[nextRandom(seed) % state.size];
+      list.remove(object).append(object);
+    }
+  });
+  doNotOptimize(list.size());
+}
+
+// The same with a list of pointers, which allocates a node per append and,
+// without an index, searches for the object to remove.
+template <typename List>
+void benchPoolChurn(State& state) {
+  vector<PoolObject> pool(state.size);
+  List list;
+  for (PoolObject& object : pool) list.append(&object);
+  const size_t count = linearBudget(state.size, 100000);
+  uint32_t seed = 8;
+  state.measure(count, [&] {
+    for (size_t i = 0; i < count; ++i) {
+      PoolObject* object = &pool[nextRandom(seed) % state.size];
+      list.remove(object, 1).append(object);
+    }
+  });
+  doNotOptimize(list.size());
+}
+
+// Builds a list whose order has drifted away from allocation order, as after
+// a long run of inserts: each element goes to a random position among the
+// first 1024, so neighbours in the list are scattered in memory.
+template <typename List>
+void scatter(List& list, const size_t count) {
+  uint32_t seed = 9;
+  for (size_t i = 0; i < count; ++i)
+    insertAt(list, nextRandom(seed) % (std::min<size_t>(sizeOf(list), 1024) + 1), int(i));
+}
+
+// Reported per element visited.
+template <typename List>
+void benchScatteredIterate(State& state) {
+  List list;
+  scatter(list, state.size);
+  int64_t total = 0;
+  state.measure(state.size, [&] { total = sum(list); });
+  doNotOptimize(total);
+}
+
+// The same after CompactLinkedList::compact() has put the elements back in
+// list order.
+void benchCompactedIterate(State& state) {
+  CompactLinkedList<int> list;
+  scatter(list, state.size);
+  list.compact();
+  int64_t total = 0;
+  state.measure(state.size, [&] { total = sum(list); });
+  doNotOptimize(total);
+}
+
+// A LinkedList of 0..size-1 whose nodes are allocated in a random order, so
+// that at every size consecutive elements are far apart in memory.
+void shuffledList(LinkedList<int>& list, const size_t count) {
+  vector<int> values(count);
+  std::iota(values.begin(), values.end(), 0);
+  uint32_t seed = 10;
+  for (size_t i = count; i > 1; --i) std::swap(values[i - 1], values[nextRandom(seed) % i]);
+  list.appendRange(values.begin(), values.end());
+  list.sort();
+}
+
+// Full scans of a shuffled list: a search for a missing value and a forEach
+// sum, with and without prefetching. Reported per element visited.
+template <bool Prefetching>
+void benchShuffledContains(State& state) {
+  LinkedList<int> list;
+  shuffledList(list, state.size);
+  list.setPrefetching(Prefetching);
+  bool found = list.contains(-1);
+  state.measure(state.size, [&] { found = list.contains(-1); });
+  doNotOptimize(found);
+}
+
+template <bool Prefetching>
+void benchShuffledForEach(State& state) {
+  LinkedList<int> list;
+  shuffledList(list, state.size);
+  list.setPrefetching(Prefetching);
+  int64_t total = 0;
+  list.forEach([&total](const int data) { total += data; });
+  state.measure(state.size, [&] { list.forEach([&total](const int data) { total += data; }); });
+  doNotOptimize(total);
+}
+
+// Full scans of a shuffled list, a search for a missing value and an
+// equality check against a copy, as left by the shuffle and after relayout.
+// Reported per element visited.
+template <bool Relaid>
+void benchFragmentedContains(State& state) {
+  LinkedList<int> list;
+  shuffledList(list, state.size);
+  if (Relaid) list.relayout();
+  bool found = list.contains(-1);
+  state.measure(state.size, [&] { found = list.contains(-1); });
+  doNotOptimize(found);
+}
+
+template <bool Relaid>
+void benchFragmentedEquality(State& state) {
+  LinkedList<int> list;
+  shuffledList(list, state.size);
+  LinkedList<int> copy(list);
+  if (Relaid) list.relayout();
+  bool equal = list == copy;
+  state.measure(state.size, [&] { equal = list == copy; });
+  doNotOptimize(equal);
+}
+
+// The cost of relaying out a shuffled list, in one call or in calls moving
+// at most 1024 nodes each. Reported per node moved.
+template <bool Incremental>
+void benchRelayout(State& state) {
+  LinkedList<int> list;
+  shuffledList(list, state.size);
+  state.measure(state.size, [&] {
+    if (Incremental)
+      for (bool done = false; !done;) done = list.relayout(1024);
+    else
+      list.relayout();
+  });
+  doNotOptimize(list.size());
+}
+
+// Builds a list from a vector of `size` elements, one append at a time or as
+// one range. Reported per element.
+template <typename List, bool Range>
+void benchBuild(State& state) {
+  vector<int> values(state.size);
+  std::iota(values.begin(), values.end(), 0);
+  List list;
+  state.measure(state.size, [&] {
+    if (Range)
+      list.appendRange(values.begin(), values.end());
+    else
+      for (const int data : values) list.append(data);
+  });
+  doNotOptimize(list.size());
+}
+
+// Sums the squares of the even elements, materializing each stage as a list,
+// through std::views, or through a generator. Reported per source element.
+enum class Pipeline { Materialized, Views, Generator };
+
+ListGenerator<int64_t> evenSquares(const LinkedList<int>& list) {
+  for (const int data : list)
+    if (data % 2 == 0) co_yield int64_t(data) * data;
+}
+
+template <Pipeline Kind>
+void benchPipeline(State& state) {
+  LinkedList<int> list;
+  fill(list, state.size);
+  auto even = [](const int data) { return data % 2 == 0; };
+  auto square = [](const int data) { return int64_t(data) * data; };
+  int64_t total = 0;
+  state.measure(state.size, [&] {
+    if (Kind == Pipeline::Materialized) {
+      LinkedList<int> evens;
+      for (const int data : list)
+        if (even(data)) evens.append(data);
+      LinkedList<int64_t> squares;
+      for (const int data : evens) squares.append(square(data));
+      for (const int64_t data : squares) total += data;
+    } else if (Kind == Pipeline::Views) {
+      for (const int64_t data : list | std::views::filter(even) | std::views::transform(square))
+        total += data;
+    } else {
+      for (const int64_t data : evenSquares(list)) total += data;
+    }
+  });
+  doNotOptimize(total);
+}
+
+// Checkpoint file used by the save and load benchmarks.
+const char* const checkpointPath = "benchlists.list";
+
+// Reported per element written.
+template <typename List>
+void benchSave(State& state) {
+  List list;
+  fill(list, state.size);
+  state.measure(state.size, [&] { list.save(checkpointPath); });
+  std::remove(checkpointPath);
+}
+
+// Reported per element read back.
+template <typename List>
+void benchLoad(State& state) {
+  List list;
+  fill(list, state.size);
+  list.save(checkpointPath);
+  state.measure(state.size, [&] { list.load(checkpointPath); });
+  std::remove(checkpointPath);
+  doNotOptimize(sizeOf(list));
+}
+
+// Opening a mapped view and summing it, which touches every page. Reported
+// per element.
+void benchMapSum(State& state) {
+  LinkedList<int> list;
+  fill(list, state.size);
+  list.save(checkpointPath);
+  int64_t total = 0;
+  state.measure(state.size, [&] {
+    MappedList<int> mapped(checkpointPath);
+    for (const int data : mapped) total += data;
+  });
+  std::remove(checkpointPath);
+  doNotOptimize(total);
+}
+
+// Per-element work heavy enough for the parallel traversals to pay off.
+int64_t heavy(const int data) {
+  uint32_t state = data;
+  for (int i = 0; i < 200; ++i) state = state * 1664525 + 1013904223;
+  return state;
+}
+
+// Reported per element.
+template <bool Parallel>
+void benchTransform(State& state) {
+  LinkedList<int> list;
+  fill(list, state.size);
+  LinkedList<int64_t> result;
+  state.measure(state.size, [&] {
+    if (Parallel) {
+      result = list.parallelTransform(heavy);
+    } else {
+      result.clear();
+      for (const int data : list) result.append(heavy(data));
+    }
+  });
+  doNotOptimize(result.size());
+}
+
+// Reported per element.
+template <bool Parallel>
+void benchReduce(State& state) {
+  LinkedList<int> list;
+  fill(list, state.size);
+  int64_t total = 0;
+  state.measure(state.size, [&] {
+    if (Parallel)
+      total = list.parallelReduce(0, std::plus<int>());
+    else
+      total = sum(list);
+  });
+  doNotOptimize(total);
+}
+
+// A reader taking a stable copy of a list that a writer keeps changing.
+// Reported per snapshot.
+template <typename List>
+void benchSnapshot(State& state) {
+  List list;
+  fill(list, state.size);
+  const size_t count = linearBudget(state.size, 100000);
+  int64_t total = 0;
+  state.measure(count, [&] {
+    for (size_t i = 0; i < count; ++i) {
+      List snapshot(list);
+      pushFront(list, int(i));
+      total += popFront(list) + sizeOf(snapshot);
+    }
+  });
+  doNotOptimize(total);
+}
+
+// LinkedList behind one mutex, the arrangement ConcurrentLinkedQueue replaces.
+class LockedQueue {
+ public:
+  void push(const int data) {
+    lock_guard<mutex> lock(this->guard);
+    this->list.append(data);
+  }
+  const bool tryPop(int& data) {
+    lock_guard<mutex> lock(this->guard);
+    if (this->list.isEmpty()) return false;
+    data = this->list.unprepend();
+    return true;
+  }
+
+ private:
+  mutex guard;
+  LinkedList<int> list;
+};
+
+// `size` is the thread count here; each thread alternates pushes and pops on
+// one shared queue.
+template <typename Queue>
+void benchQueueThreads(State& state) {
+  Queue queue;
+  const size_t perThread = 200000;
+  atomic<int64_t> total(0);
+  vector<thread> threads;
+  state.measure(2 * perThread * state.size, [&] {
+    for (size_t t = 0; t < state.size; ++t)
+      threads.emplace_back([&queue, &total, perThread] {
+        int64_t local = 0;
+        int data;
+        for (size_t i = 0; i < perThread; ++i) {
+          queue.push(int(i));
+          if (queue.tryPop(data)) local += data;
+        }
+        total += local;
+      });
+    for (thread& worker : threads) worker.join();
+  });
+  doNotOptimize(total.load());
+}
+
+//-----------------------------------------------------------------------------
+
+void registerAll() {
+  registerCommon<LinkedList<int>>("LinkedList");
+  registerCommon<LinkedList<int, SlabAllocator<int>>>("LinkedList+Slab");
+  registerCommon<DoublyLinkedList<int>>("DoublyLinkedList");
+  registerCommon<UnrolledLinkedList<int, 16>>("UnrolledLinkedList<16>");
+  registerCommon<SkipList<int>>("SkipList");
+  registerCommon<IndexedLinkedList<int>>("IndexedLinkedList");
+  registerCommon<CompactLinkedList<int>>("CompactLinkedList");
+  registerCommon<std::list<int>>("std::list");
+  registerCommon<TailedForwardList<int>>("std::forward_list");
+  // Prepending to a vector is quadratic.
+  registerCommon<vector<int>>("std::vector", 100000);
+
+  registerBenchmark("count", "LinkedList", benchCount<LinkedList<int>>);
+  registerBenchmark("count", "UnrolledLinkedList<16>", benchCount<UnrolledLinkedList<int, 16>>);
+  registerBenchmark("count", "std::list", benchCount<std::list<int>>);
+  registerBenchmark("count", "std::vector", benchCount<vector<int>>);
+
+  // Element types with other vector lane widths.
+  registerBenchmark("contains", "LinkedList float", benchContains<LinkedList<float>>);
+  registerBenchmark("contains", "UnrolledLinkedList<16> float",
+                    benchContains<UnrolledLinkedList<float, 16>>);
+  registerBenchmark("contains", "LinkedList uint64_t", benchContains<LinkedList<uint64_t>>);
+  registerBenchmark("contains", "UnrolledLinkedList<16> uint64_t",
+                    benchContains<UnrolledLinkedList<uint64_t, 16>>);
+  registerBenchmark("count", "UnrolledLinkedList<16> float",
+                    benchCount<UnrolledLinkedList<float, 16>>);
+  registerBenchmark("count", "UnrolledLinkedList<16> uint64_t",
+                    benchCount<UnrolledLinkedList<uint64_t, 16>>);
+  registerBenchmark("equality", "LinkedList float", benchEquality<LinkedList<float>>);
+  registerBenchmark("equality", "UnrolledLinkedList<16> float",
+                    benchEquality<UnrolledLinkedList<float, 16>>);
+  registerBenchmark("equality", "LinkedList uint64_t", benchEquality<LinkedList<uint64_t>>);
+  registerBenchmark("equality", "UnrolledLinkedList<16> uint64_t",
+                    benchEquality<UnrolledLinkedList<uint64_t, 16>>);
+
+  registerBenchmark("churn", "LinkedList", benchChurn<LinkedList<int>>);
+  registerBenchmark("churn", "LinkedList+Slab", benchChurn<LinkedList<int, SlabAllocator<int>>>);
+  registerBenchmark("churn", "LinkedList+Statistics", benchChurn<CountedList>);
+  registerBenchmark("churn", "DoublyLinkedList", benchChurn<DoublyLinkedList<int>>);
+  registerBenchmark("churn", "std::list", benchChurn<std::list<int>>);
+  registerBenchmark("churn", "std::forward_list", benchChurn<TailedForwardList<int>>);
+  // Inline storage: the resident elements plus the one pushed each round.
+  registerBenchmark("churn", "StaticLinkedList<1025>", benchChurn<StaticLinkedList<int, 1025>>,
+                    1024);
+
+  registerBenchmark("unappend", "LinkedList", benchUnappend<LinkedList<int>>);
+  registerBenchmark("unappend", "LinkedList+Statistics", benchUnappend<CountedList>);
+  registerBenchmark("unappend", "DoublyLinkedList", benchUnappend<DoublyLinkedList<int>>);
+  registerBenchmark("unappend", "std::list", benchUnappend<std::list<int>>);
+  registerBenchmark("unappend", "std::vector", benchUnappend<vector<int>>);
+
+  // Only LinkedList resumes from its previous position; the others restart
+  // every access, so they are capped where the loop turns quadratic.
+  registerBenchmark("indexed-loop", "LinkedList", benchIndexedLoop<LinkedList<int>>);
+  registerBenchmark("indexed-loop", "LinkedList+Statistics", benchIndexedLoop<CountedList>);
+  registerBenchmark("indexed-loop", "DoublyLinkedList", benchIndexedLoop<DoublyLinkedList<int>>,
+                    100000);
+  registerBenchmark("indexed-loop", "UnrolledLinkedList<16>",
+                    benchIndexedLoop<UnrolledLinkedList<int, 16>>, 100000);
+  registerBenchmark("indexed-loop", "SkipList", benchIndexedLoop<SkipList<int>>);
+  registerBenchmark("indexed-loop", "std::list", benchIndexedLoop<std::list<int>>, 100000);
+  registerBenchmark("indexed-loop", "std::vector", benchIndexedLoop<vector<int>>);
+
+  registerBenchmark("splice", "LinkedList", benchSplice<LinkedList<int>>);
+  registerBenchmark("splice", "std::list", benchSplice<std::list<int>>);
+
+  registerBenchmark("sort", "LinkedList", benchSort<LinkedList<int>>);
+  registerBenchmark("sort", "LinkedList+Slab", benchSort<LinkedList<int, SlabAllocator<int>>>);
+  registerBenchmark("sort", "LinkedList via vector", benchSortThroughVector);
+  registerBenchmark("sort", "std::list", benchSort<std::list<int>>);
+
+  registerBenchmark("merge", "LinkedList", benchMerge<LinkedList<int>>);
+  registerBenchmark("merge", "std::list", benchMerge<std::list<int>>);
+
+  // Linear per operation without the index, so capped.
+  registerBenchmark("lookup", "LinkedList", benchLookup<LinkedList<int>>, 100000);
+  registerBenchmark("lookup", "IndexedLinkedList", benchLookup<IndexedLinkedList<int>>);
+  registerBenchmark("remove-value", "LinkedList", benchRemoveValue<LinkedList<int>>, 100000);
+  registerBenchmark("remove-value", "IndexedLinkedList",
+                    benchRemoveValue<IndexedLinkedList<int>>);
+  registerBenchmark("dedup", "LinkedList", benchDedup<LinkedList<int>>, 100000);
+  registerBenchmark("dedup", "IndexedLinkedList", benchDedup<IndexedLinkedList<int>>);
+
+  registerBenchmark("pool-churn", "IntrusiveLinkedList", benchPoolChurnIntrusive);
+  registerBenchmark("pool-churn", "LinkedList<T*>", benchPoolChurn<LinkedList<PoolObject*>>,
+                    100000);
+  registerBenchmark("pool-churn", "IndexedLinkedList<T*>",
+                    benchPoolChurn<IndexedLinkedList<PoolObject*>>);
+
+  registerBenchmark("scattered-iterate", "LinkedList", benchScatteredIterate<LinkedList<int>>);
+  registerBenchmark("scattered-iterate", "CompactLinkedList",
+                    benchScatteredIterate<CompactLinkedList<int>>);
+  registerBenchmark("scattered-iterate", "CompactLinkedList compacted", benchCompactedIterate);
+  registerBenchmark("scattered-iterate", "std::list", benchScatteredIterate<std::list<int>>);
+
+  registerBenchmark("shuffled-contains", "LinkedList", benchShuffledContains<false>);
+  registerBenchmark("shuffled-contains", "LinkedList prefetching", benchShuffledContains<true>);
+  registerBenchmark("shuffled-foreach", "LinkedList", benchShuffledForEach<false>);
+  registerBenchmark("shuffled-foreach", "LinkedList prefetching", benchShuffledForEach<true>);
+
+  registerBenchmark("tiny-lists", "LinkedList", benchTinyLists<LinkedList<int>>, 10);
+  registerBenchmark("tiny-lists", "SmallLinkedList<8>", benchTinyLists<SmallLinkedList<int, 8>>,
+                    10);
+  registerBenchmark("tiny-lists", "std::list", benchTinyLists<std::list<int>>, 10);
+  registerBenchmark("tiny-lists", "std::vector", benchTinyLists<vector<int>>, 10);
+
+  registerBenchmark("fragmented-contains", "LinkedList", benchFragmentedContains<false>);
+  registerBenchmark("fragmented-contains", "LinkedList relaid out", benchFragmentedContains<true>);
+  registerBenchmark("fragmented-equality", "LinkedList", benchFragmentedEquality<false>);
+  registerBenchmark("fragmented-equality", "LinkedList relaid out", benchFragmentedEquality<true>);
+  registerBenchmark("relayout", "LinkedList", benchRelayout<false>);
+  registerBenchmark("relayout", "LinkedList incremental", benchRelayout<true>);
+
+  registerBenchmark("build", "LinkedList append", benchBuild<LinkedList<int>, false>);
+  registerBenchmark("build", "LinkedList appendRange", benchBuild<LinkedList<int>, true>);
+  registerBenchmark("build", "LinkedList+Slab append",
+                    benchBuild<LinkedList<int, SlabAllocator<int>>, false>);
+  registerBenchmark("build", "LinkedList+Slab appendRange",
+                    benchBuild<LinkedList<int, SlabAllocator<int>>, true>);
+
+  registerBenchmark("pipeline", "LinkedList materialized", benchPipeline<Pipeline::Materialized>);
+  registerBenchmark("pipeline", "LinkedList views", benchPipeline<Pipeline::Views>);
+  registerBenchmark("pipeline", "LinkedList generator", benchPipeline<Pipeline::Generator>);
+
+  registerBenchmark("save", "LinkedList", benchSave<LinkedList<int>>);
+  registerBenchmark("save", "CompactLinkedList", benchSave<CompactLinkedList<int>>);
+  registerBenchmark("load", "LinkedList", benchLoad<LinkedList<int>>);
+  registerBenchmark("load", "CompactLinkedList", benchLoad<CompactLinkedList<int>>);
+  registerBenchmark("load", "MappedList", benchMapSum);
+
+  registerBenchmark("transform", "LinkedList serial", benchTransform<false>);
+  registerBenchmark("transform", "LinkedList parallel", benchTransform<true>);
+  registerBenchmark("reduce", "LinkedList serial", benchReduce<false>);
+  registerBenchmark("reduce", "LinkedList parallel", benchReduce<true>);
+
+  registerBenchmark("snapshot", "LinkedList", benchSnapshot<LinkedList<int>>);
+  registerBenchmark("snapshot", "PersistentList", benchSnapshot<PersistentList<int>>);
+  registerBenchmark("prepend", "PersistentList", benchPrepend<PersistentList<int>>);
+  registerBenchmark("iterate", "PersistentList", benchIterate<PersistentList<int>>);
+  registerBenchmark("iterate", "StaticLinkedList<1024>",
+                    benchIterate<StaticLinkedList<int, 1024>>, 1024);
+
+  registerBenchmark("queue-threads", "LinkedList+mutex", benchQueueThreads<LockedQueue>);
+  registerBenchmark("queue-threads", "ConcurrentLinkedQueue",
+                    benchQueueThreads<ConcurrentLinkedQueue<int>>);
+}
+
+//-----------------------------------------------------------------------------
+// Runner and reporters
+
+struct Options {
+  string format = "table";
+  string out;
+  string filter;
+  size_t minSize = 10;
+  size_t maxSize = 10000000;
+  double minTimeMilliseconds = 100;
+};
+
+vector<size_t> sizesFor(const Benchmark& benchmark, const Options& options) {
+  vector<size_t> sizes;
+  if (benchmark.name == "queue-threads") {
+    size_t cores = std::max(2u, thread::hardware_concurrency());
+    for (size_t threads = 1; threads <= cores; threads *= 2) sizes.push_back(threads);
+    return sizes;
+  }
+  for (size_t size = 10; size <= 10000000; size *= 10)
+    if (size >= options.minSize && size <= options.maxSize && size <= benchmark.maxSize)
+      sizes.push_back(size);
+  return sizes;
+}
+
+// Repeats until the measured time reaches the minimum, giving up after ten
+// times that in wall time so setup-heavy benchmarks still finish.
+Result run(const Benchmark& benchmark, const size_t size, const Options& options) {
+  State state(size);
+  size_t repetitions = 0;
+  auto start = chrono::steady_clock::now();
+  auto deadline = start + chrono::duration<double, milli>(10 * options.minTimeMilliseconds);
+  do {
+    benchmark.body(state);
+    ++repetitions;
+  } while (state.nanoseconds < options.minTimeMilliseconds * 1e6 &&
+           chrono::steady_clock::now() < deadline);
+  return Result{benchmark.name, benchmark.container, size, repetitions, state.operations,
+                state.nanoseconds / state.operations};
+}
+
+void writeTable(FILE* output, const vector<Result>& results) {
+  fprintf(output, "%-14s %-24s %10s %6s %12s %14s\n", "benchmark", "container", "size",
+          "reps", "operations", "ns/op");
+  for (const Result& result : results)
+    fprintf(output, "%-14s %-24s %10zu %6zu %12zu %14.3f\n", result.name.c_str(),
+            result.container.c_str(), result.size, result.repetitions, result.operations,
+            result.nanosecondsPerOperation);
+}
+
+void writeCsv(FILE* output, const vector<Result>& results) {
+  fprintf(output, "benchmark,container,size,repetitions,operations,ns_per_op\n");
+  for (const Result& result : results)
+    fprintf(output, "%s,%s,%zu,%zu,%zu,%.3f\n", result.name.c_str(), result.container.c_str(),
+            result.size, result.repetitions, result.operations,
+            result.nanosecondsPerOperation);
+}
+
+void writeJson(FILE* output, const vector<Result>& results) {
+  fprintf(output, "{\n  \"benchmarks\": [\n");
+  for (size_t i = 0; i < results.size(); ++i)
+    fprintf(output,
+            "    {\"benchmark\": \"%s\", \"container\": \"%s\", \"size\": %zu, "
+            "\"repetitions\": %zu, \"operations\": %zu, \"ns_per_op\": %.3f}%s\n",
+            results[i].name.c_str(), results[i].container.c_str(), results[i].size,
+            results[i].repetitions, results[i].operations,
+            results[i].nanosecondsPerOperation, i + 1 < results.size() ? "," : "");
+  fprintf(output, "  ]\n}\n");
+}
+
+bool parseOption(const char* argument, const char* name, string& value) {
+  size_t length = strlen(name);
+  if (strncmp(argument, name, length) != 0 || argument[length] != '=') return false;
+  value = argument + length + 1;
+  return true;
+}
+
+int main(int argc, char* argv[]) {
+  Options options;
+  for (int i = 1; i < argc; ++i) {
+    string value;
+    if (parseOption(argv[i], "--format", value))
+      options.format = value;
+    else if (parseOption(argv[i], "--out", value))
+      options.out = value;
+    else if (parseOption(argv[i], "--filter", value))
+      options.filter = value;
+    else if (parseOption(argv[i], "--min-size", value))
+      options.minSize = strtoull(value.c_str(), nullptr, 10);
+    else if (parseOption(argv[i], "--max-size", value))
+      options.maxSize = strtoull(value.c_str(), nullptr, 10);
+    else if (parseOption(argv[i], "--min-time", value))
+      options.minTimeMilliseconds = strtod(value.c_str(), nullptr);
+    else {
+      fprintf(stderr,
+              "usage: %s [--format=table|csv|json] [--out=FILE] [--filter=TEXT]\n"
+              "       [--min-size=N] [--max-size=N] [--min-time=MS]\n",
+              argv[0]);
+      return 1;
+    }
+  }
+  if (options.format != "table" && options.format != "csv" && options.format != "json") {
+    fprintf(stderr, "unknown format: %s\n", options.format.c_str());
+    return 1;
+  }
+
+  registerAll();
+  vector<Result> results;
+  for (const Benchmark& benchmark : registry()) {
+    string label = benchmark.name + "/" + benchmark.container;
+    if (label.find(options.filter) == string::npos) continue;
+    for (size_t size : sizesFor(benchmark, options)) {
+      results.push_back(run(benchmark, size, options));
+      fprintf(stderr, "%s/%zu: %.3f ns/op\n", label.c_str(), size,
+              results.back().nanosecondsPerOperation);
+    }
+  }
+
+  FILE* output = options.out.empty() ? stdout : fopen(options.out.c_str(), "w");
+  if (!output) {
+    fprintf(stderr, "cannot open %s\n", options.out.c_str());
+    return 1;
+  }
+  if (options.format == "csv")
+    writeCsv(output, results);
+  else if (options.format == "json")
+    writeJson(output, results);
+  else
+    writeTable(output, results);
+  if (output != stdout) fclose(output);
+  return 0;
+}
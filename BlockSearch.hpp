@@ -0,0 +1,212 @@
+#ifndef BLOCKSEARCH_HPP
+#define BLOCKSEARCH_HPP
+
+#include <stddef.h>
+#include <type_traits>
+#if defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+// Equality kernels over a contiguous run of elements, used by the lists that
+// keep their elements in arrays. For integers and float/double they compare a
+// whole vector register per step: SSE2 (16 bytes) on any x86-64 build, AVX2
+// (32 bytes) when the compiler targets it, e.g. with -mavx2 or -march=native.
+// Every other type, and every other platform, takes the scalar loop. Floating
+// point follows operator==: NaN matches nothing and 0.0 matches -0.0.
+template <typename T, typename = void>
+struct BlockSearch {
+  static const bool vectorized = false;
+
+  // Position of the first element equal to `data`, or `count` if none is.
+  static std::size_t find(const T* values, const std::size_t count, const T& data) {
+    for (std::size_t i = 0; i < count; ++i)
+      if (values[i] == data) return i;
+    return count;
+  }
+
+  static std::size_t count(const T* values, const std::size_t count, const T& data) {
+    std::size_t found = 0;
+    for (std::size_t i = 0; i < count; ++i)
+      if (values[i] == data) ++found;
+    return found;
+  }
+
+  static bool equal(const T* a, const T* b, const std::size_t count) {
+    for (std::size_t i = 0; i < count; ++i)
+      if (!(a[i] == b[i])) return false;
+    return true;
+  }
+};
+
+#if defined(__SSE2__)
+
+// Helpers of the vectorized kernels, kept out of the global namespace of every
+// file that includes a list.
+namespace detail {
+
+#if defined(__AVX2__)
+using BlockRegister = __m256i;
+static const unsigned int blockAllLanes = 0xFFFFFFFFu;
+
+inline BlockRegister blockLoad(const void* from) {
+  return _mm256_loadu_si256(static_cast<const __m256i*>(from));
+}
+#else
+using BlockRegister = __m128i;
+static const unsigned int blockAllLanes = 0xFFFFu;
+
+inline BlockRegister blockLoad(const void* from) {
+  return _mm_loadu_si128(static_cast<const __m128i*>(from));
+}
+#endif
+
+// One bit per byte of the register, set where the lanes of `a` and `b` holding
+// that byte compare equal as a `Size`-byte integer or, when `Floating`, as a
+// float or double.
+template <std::size_t Size, bool Floating>
+struct BlockEqualMask;
+
+#if defined(__AVX2__)
+template <>
+struct BlockEqualMask<1, false> {
+  static unsigned int of(BlockRegister a, BlockRegister b) {
+    return _mm256_movemask_epi8(_mm256_cmpeq_epi8(a, b));
+  }
+};
+template <>
+struct BlockEqualMask<2, false> {
+  static unsigned int of(BlockRegister a, BlockRegister b) {
+    return _mm256_movemask_epi8(_mm256_cmpeq_epi16(a, b));
+  }
+};
+template <>
+struct BlockEqualMask<4, false> {
+  static unsigned int of(BlockRegister a, BlockRegister b) {
+    return _mm256_movemask_epi8(_mm256_cmpeq_epi32(a, b));
+  }
+};
+template <>
+struct BlockEqualMask<8, false> {
+  static unsigned int of(BlockRegister a, BlockRegister b) {
+    return _mm256_movemask_epi8(_mm256_cmpeq_epi64(a, b));
+  }
+};
+template <>
+struct BlockEqualMask<4, true> {
+  static unsigned int of(BlockRegister a, BlockRegister b) {
+    __m256 equal = _mm256_cmp_ps(_mm256_castsi256_ps(a), _mm256_castsi256_ps(b), _CMP_EQ_OQ);
+    return _mm256_movemask_epi8(_mm256_castps_si256(equal));
+  }
+};
+template <>
+struct BlockEqualMask<8, true> {
+  static unsigned int of(BlockRegister a, BlockRegister b) {
+    __m256d equal = _mm256_cmp_pd(_mm256_castsi256_pd(a), _mm256_castsi256_pd(b), _CMP_EQ_OQ);
+    return _mm256_movemask_epi8(_mm256_castpd_si256(equal));
+  }
+};
+#else
+template <>
+struct BlockEqualMask<1, false> {
+  static unsigned int of(BlockRegister a, BlockRegister b) {
+    return _mm_movemask_epi8(_mm_cmpeq_epi8(a, b));
+  }
+};
+template <>
+struct BlockEqualMask<2, false> {
+  static unsigned int of(BlockRegister a, BlockRegister b) {
+    return _mm_movemask_epi8(_mm_cmpeq_epi16(a, b));
+  }
+};
+template <>
+struct BlockEqualMask<4, false> {
+  static unsigned int of(BlockRegister a, BlockRegister b) {
+    return _mm_movemask_epi8(_mm_cmpeq_epi32(a, b));
+  }
+};
+// SSE2 has no 64-bit compare: a lane is equal when both of its halves are.
+template <>
+struct BlockEqualMask<8, false> {
+  static unsigned int of(BlockRegister a, BlockRegister b) {
+    __m128i halves = _mm_cmpeq_epi32(a, b);
+    return _mm_movemask_epi8(_mm_and_si128(halves, _mm_shuffle_epi32(halves, 0xB1)));
+  }
+};
+template <>
+struct BlockEqualMask<4, true> {
+  static unsigned int of(BlockRegister a, BlockRegister b) {
+    return _mm_movemask_epi8(
+        _mm_castps_si128(_mm_cmpeq_ps(_mm_castsi128_ps(a), _mm_castsi128_ps(b))));
+  }
+};
+template <>
+struct BlockEqualMask<8, true> {
+  static unsigned int of(BlockRegister a, BlockRegister b) {
+    return _mm_movemask_epi8(
+        _mm_castpd_si128(_mm_cmpeq_pd(_mm_castsi128_pd(a), _mm_castsi128_pd(b))));
+  }
+};
+#endif
+
+template <typename T>
+struct BlockVectorizable
+    : std::integral_constant<bool, (std::is_integral<T>::value && !std::is_same<T, bool>::value &&
+                                    (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 ||
+                                     sizeof(T) == 8)) ||
+                                       std::is_same<T, float>::value ||
+                                       std::is_same<T, double>::value> {};
+
+}  // namespace detail
+
+template <typename T>
+struct BlockSearch<T, typename std::enable_if<detail::BlockVectorizable<T>::value>::type> {
+  static const bool vectorized = true;
+
+  static std::size_t find(const T* values, const std::size_t count, const T& data) {
+    const detail::BlockRegister needle = splat(data);
+    std::size_t i = 0;
+    for (; i + lanes <= count; i += lanes) {
+      unsigned int mask = Mask::of(detail::blockLoad(values + i), needle);
+      if (mask) return i + __builtin_ctz(mask) / sizeof(T);
+    }
+    for (; i < count; ++i)
+      if (values[i] == data) return i;
+    return count;
+  }
+
+  static std::size_t count(const T* values, const std::size_t count, const T& data) {
+    const detail::BlockRegister needle = splat(data);
+    std::size_t found = 0;
+    std::size_t i = 0;
+    for (; i + lanes <= count; i += lanes)
+      found += __builtin_popcount(Mask::of(detail::blockLoad(values + i), needle));
+    found /= sizeof(T);
+    for (; i < count; ++i)
+      if (values[i] == data) ++found;
+    return found;
+  }
+
+  static bool equal(const T* a, const T* b, const std::size_t count) {
+    std::size_t i = 0;
+    for (; i + lanes <= count; i += lanes)
+      if (Mask::of(detail::blockLoad(a + i), detail::blockLoad(b + i)) != detail::blockAllLanes)
+        return false;
+    for (; i < count; ++i)
+      if (!(a[i] == b[i])) return false;
+    return true;
+  }
+
+ private:
+  using Mask = detail::BlockEqualMask<sizeof(T), std::is_floating_point<T>::value>;
+  static const std::size_t lanes = sizeof(detail::BlockRegister) / sizeof(T);
+
+  static detail::BlockRegister splat(const T& data) {
+    T copies[lanes];
+    for (std::size_t i = 0; i < lanes; ++i) copies[i] = data;
+    return detail::blockLoad(copies);
+  }
+};
+
+#endif
+
+#endif
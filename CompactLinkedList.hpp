@@ -0,0 +1,603 @@
+#ifndef COMPACTLINKEDLIST_HPP
+#define COMPACTLINKEDLIST_HPP
+
+#include <stddef.h>
+#include <stdint.h>
+#include <algorithm>
+#include <initializer_list>
+#include <memory>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "BlockSearch.hpp"
+#include "CompactLinkedListIterator.hpp"
+#include "ListFile.hpp"
+#include "ListIndexOutOfBounds.hpp"
+
+// Singly linked list kept in two parallel arrays: the elements, and a 32-bit
+// index of each element's successor. That is 4 bytes of overhead per element
+// instead of a node allocation plus a 64-bit pointer. Removed slots are
+// pushed on a free stack threaded through the link array and reused first.
+// compact() moves the elements into list order, after which a scan reads
+// memory sequentially. While the list is in that order (compacted and only
+// appended to or trimmed at the back since), operator[] and unappend are O(1),
+// and contains and operator== scan the element array with BlockSearch.
+// Holds at most 2^32 - 1 elements.
+template <typename T>
+class CompactLinkedList {
+ public:
+  using value_type = T;
+  using size_type = std::size_t;
+  using reference = T&;
+  using const_reference = const T&;
+  using iterator = CompactLinkedListIterator<T>;
+  using const_iterator = CompactLinkedListIterator<T, true>;
+
+  // Constructors
+  CompactLinkedList();
+  CompactLinkedList(const T&);
+  CompactLinkedList(const std::initializer_list<T>);
+  CompactLinkedList(const CompactLinkedList&);
+  CompactLinkedList(CompactLinkedList&&) noexcept;
+  CompactLinkedList& operator=(const CompactLinkedList&);
+  CompactLinkedList& operator=(CompactLinkedList&&) noexcept;
+  ~CompactLinkedList();
+
+  // Getters
+  const T& getHead() const;
+  const T& getTail() const;
+  const bool isEmpty() const;
+  const bool contains(const T&) const;
+  const std::size_t size() const;
+  const std::size_t capacity() const;
+
+  // Mutators
+  CompactLinkedList<T>& append(const T&);
+  CompactLinkedList<T>& append(T&&);
+  CompactLinkedList<T>& prepend(const T&);
+  CompactLinkedList<T>& prepend(T&&);
+  CompactLinkedList<T>& insert(const T&, const std::size_t);
+  CompactLinkedList<T>& insert(T&&, const std::size_t);
+  T unappend();
+  T unprepend();
+  T remove(const std::size_t);
+  CompactLinkedList<T>& remove(const T&, const std::size_t);
+  void clear();
+  void reserve(const std::size_t);
+  CompactLinkedList<T>& compact();
+
+  // Files
+  void save(const std::string&) const;
+  CompactLinkedList<T>& load(const std::string&);
+
+  // Iterators
+  iterator begin();
+  iterator end();
+  const_iterator begin() const;
+  const_iterator end() const;
+  const_iterator cbegin() const;
+  const_iterator cend() const;
+
+  // Operators
+  const bool operator==(const CompactLinkedList&) const;
+  const bool operator!=(const CompactLinkedList&) const;
+  const T& operator[](const std::size_t) const;
+  T& operator[](const std::size_t);
+
+  // Friend Operator
+  friend std::ostream& operator<<(std::ostream& output, const CompactLinkedList& self) {
+    output << "[";
+    for (uint32_t slot = self.head; slot != none; slot = self.links[slot]) {
+      output << self.values[slot];
+      if (self.links[slot] != none) output << "->";
+    }
+    output << "]";
+    return output;
+  }
+
+ private:
+  using Traits = std::allocator_traits<std::allocator<T>>;
+
+  // End of a chain, in both the list and the free stack.
+  static constexpr uint32_t none = UINT32_MAX;
+
+  template <typename... Args>
+  CompactLinkedList<T>& emplace(const std::size_t, Args&&...);
+  template <typename... Args>
+  uint32_t createSlot(Args&&...);
+  void destroySlot(uint32_t);
+  uint32_t slotAt(const std::size_t) const;
+  T release(uint32_t, uint32_t);
+  void linkInOrder();
+  void readFrom(ListFileReader<T>&, std::true_type);
+  void readFrom(ListFileReader<T>&, std::false_type);
+  T* allocateSlots(const std::size_t);
+  void adoptSlots(T*, const std::size_t);
+  void relocate(T*, const bool);
+
+  std::allocator<T> allocator;
+  // Raw storage for `slots` elements; only the slots on the list are live.
+  T* values;
+  // Successor of every slot handed out so far; its size is the high-water mark.
+  std::vector<uint32_t> links;
+  std::size_t slots;
+  uint32_t head;
+  uint32_t tail;
+  uint32_t freeSlot;
+  std::size_t length;
+  // Element i is in slot i.
+  bool ordered;
+};
+
+template <typename T>
+CompactLinkedList<T>::CompactLinkedList()
+    : values(nullptr),
+      slots(0),
+      head(none),
+      tail(none),
+      freeSlot(none),
+      length(0),
+      ordered(true) {}
+
+template <typename T>
+CompactLinkedList<T>::CompactLinkedList(const T& data) : CompactLinkedList() {
+  this->append(data);
+}
+
+template <typename T>
+CompactLinkedList<T>::CompactLinkedList(const std::initializer_list<T> args)
+    : CompactLinkedList() {
+  this->reserve(args.size());
+  for (const T& data : args) this->append(data);
+}
+
+template <typename T>
+CompactLinkedList<T>::CompactLinkedList(const CompactLinkedList& other) : CompactLinkedList() {
+  this->reserve(other.length);
+  for (const T& data : other) this->append(data);
+}
+
+template <typename T>
+CompactLinkedList<T>::CompactLinkedList(CompactLinkedList&& other) noexcept
+    : values(other.values),
+      links(std::move(other.links)),
+      slots(other.slots),
+      head(other.head),
+      tail(other.tail),
+      freeSlot(other.freeSlot),
+      length(other.length),
+      ordered(other.ordered) {
+  other.values = nullptr;
+  other.links.clear();
+  other.slots = 0;
+  other.head = none;
+  other.tail = none;
+  other.freeSlot = none;
+  other.length = 0;
+  other.ordered = true;
+}
+
+template <typename T>
+CompactLinkedList<T>& CompactLinkedList<T>::operator=(const CompactLinkedList& other) {
+  if (this != &other) {
+    this->clear();
+    this->reserve(other.length);
+    for (const T& data : other) this->append(data);
+  }
+  return *this;
+}
+
+template <typename T>
+CompactLinkedList<T>& CompactLinkedList<T>::operator=(CompactLinkedList&& other) noexcept {
+  if (this != &other) {
+    this->clear();
+    std::swap(this->values, other.values);
+    std::swap(this->links, other.links);
+    std::swap(this->slots, other.slots);
+    std::swap(this->head, other.head);
+    std::swap(this->tail, other.tail);
+    std::swap(this->freeSlot, other.freeSlot);
+    std::swap(this->length, other.length);
+    std::swap(this->ordered, other.ordered);
+  }
+  return *this;
+}
+
+template <typename T>
+CompactLinkedList<T>::~CompactLinkedList() {
+  this->clear();
+  if (this->values) Traits::deallocate(this->allocator, this->values, this->slots);
+}
+
+template <typename T>
+const T& CompactLinkedList<T>::getHead() const {
+  if (this->isEmpty()) throw ListIndexOutOfBounds();
+  return this->values[this->head];
+}
+
+template <typename T>
+const T& CompactLinkedList<T>::getTail() const {
+  if (this->isEmpty()) throw ListIndexOutOfBounds();
+  return this->values[this->tail];
+}
+
+template <typename T>
+const bool CompactLinkedList<T>::isEmpty() const {
+  return this->length == 0;
+}
+
+template <typename T>
+const bool CompactLinkedList<T>::contains(const T& data) const {
+  if (this->ordered) return BlockSearch<T>::find(this->values, this->length, data) < this->length;
+  for (uint32_t slot = this->head; slot != none; slot = this->links[slot])
+    if (this->values[slot] == data) return true;
+  return false;
+}
+
+template <typename T>
+const std::size_t CompactLinkedList<T>::size() const {
+  return this->length;
+}
+
+template <typename T>
+const std::size_t CompactLinkedList<T>::capacity() const {
+  return this->slots;
+}
+
+template <typename T>
+CompactLinkedList<T>& CompactLinkedList<T>::append(const T& data) {
+  return this->emplace(this->length, data);
+}
+
+template <typename T>
+CompactLinkedList<T>& CompactLinkedList<T>::append(T&& data) {
+  return this->emplace(this->length, std::move(data));
+}
+
+template <typename T>
+CompactLinkedList<T>& CompactLinkedList<T>::prepend(const T& data) {
+  return this->emplace(0, data);
+}
+
+template <typename T>
+CompactLinkedList<T>& CompactLinkedList<T>::prepend(T&& data) {
+  return this->emplace(0, std::move(data));
+}
+
+template <typename T>
+CompactLinkedList<T>& CompactLinkedList<T>::insert(const T& data, const std::size_t index) {
+  return this->emplace(index, data);
+}
+
+template <typename T>
+CompactLinkedList<T>& CompactLinkedList<T>::insert(T&& data, const std::size_t index) {
+  return this->emplace(index, std::move(data));
+}
+
+template <typename T>
+T CompactLinkedList<T>::unappend() {
+  if (this->isEmpty()) throw ListIndexOutOfBounds(0, 0);
+  return this->release(this->length > 1 ? this->slotAt(this->length - 2) : none, this->tail);
+}
+
+template <typename T>
+T CompactLinkedList<T>::unprepend() {
+  if (this->isEmpty()) throw ListIndexOutOfBounds(0, 0);
+  return this->release(none, this->head);
+}
+
+template <typename T>
+T CompactLinkedList<T>::remove(const std::size_t index) {
+  if (index >= this->length) throw ListIndexOutOfBounds(index, this->length);
+  uint32_t prior = index ? this->slotAt(index - 1) : none;
+  return this->release(prior, prior == none ? this->head : this->links[prior]);
+}
+
+template <typename T>
+CompactLinkedList<T>& CompactLinkedList<T>::remove(const T& data, const std::size_t num) {
+  std::size_t numRemoved = 0;
+  uint32_t prior = none;
+  uint32_t slot = this->head;
+  while (numRemoved < num && slot != none) {
+    uint32_t next = this->links[slot];
+    if (this->values[slot] == data) {
+      this->release(prior, slot);
+      ++numRemoved;
+    } else {
+      prior = slot;
+    }
+    slot = next;
+  }
+  return *this;
+}
+
+// Destroys the elements but keeps the storage.
+template <typename T>
+void CompactLinkedList<T>::clear() {
+  for (uint32_t slot = this->head; slot != none; slot = this->links[slot])
+    Traits::destroy(this->allocator, this->values + slot);
+  this->links.clear();
+  this->head = none;
+  this->tail = none;
+  this->freeSlot = none;
+  this->length = 0;
+  this->ordered = true;
+}
+
+template <typename T>
+void CompactLinkedList<T>::reserve(const std::size_t count) {
+  if (count <= this->slots) return;
+  T* moved = this->allocateSlots(count);
+  try {
+    this->relocate(moved, false);
+  } catch (...) {
+    Traits::deallocate(this->allocator, moved, count);
+    throw;
+  }
+  this->adoptSlots(moved, count);
+}
+
+// Moves element i into slot i and threads the links in order, so traversal
+// walks memory front to back. Keeps the capacity.
+template <typename T>
+CompactLinkedList<T>& CompactLinkedList<T>::compact() {
+  if (this->ordered && this->links.size() == this->length) return *this;
+  T* packed = this->allocateSlots(this->slots);
+  try {
+    this->relocate(packed, true);
+  } catch (...) {
+    Traits::deallocate(this->allocator, packed, this->slots);
+    throw;
+  }
+  this->adoptSlots(packed, this->slots);
+  this->linkInOrder();
+  return *this;
+}
+
+// Writes the list in the ListFile format. In list order the elements go out
+// in one write.
+template <typename T>
+void CompactLinkedList<T>::save(const std::string& path) const {
+  ListFileWriter<T> writer(path, this->length);
+  if (this->ordered)
+    writer.write(this->values, this->length);
+  else
+    for (uint32_t slot = this->head; slot != none; slot = this->links[slot])
+      writer.write(this->values[slot]);
+  writer.finish();
+}
+
+// Replaces the contents with a list read from `path`, in list order. Leaves
+// the list unchanged if the file cannot be read. The storage is reserved from
+// the header's element count, which the reader has checked against the size of
+// the file, so a damaged count is reported as truncation before allocating.
+template <typename T>
+CompactLinkedList<T>& CompactLinkedList<T>::load(const std::string& path) {
+  ListFileReader<T> reader(path);
+  CompactLinkedList<T> loaded;
+  loaded.reserve(reader.size());
+  loaded.readFrom(reader, std::is_trivially_copyable<T>());
+  return *this = std::move(loaded);
+}
+
+template <typename T>
+typename CompactLinkedList<T>::iterator CompactLinkedList<T>::begin() {
+  return iterator(this->values, this->links.data(), this->head);
+}
+
+template <typename T>
+typename CompactLinkedList<T>::iterator CompactLinkedList<T>::end() {
+  return iterator(this->values, this->links.data(), none);
+}
+
+template <typename T>
+typename CompactLinkedList<T>::const_iterator CompactLinkedList<T>::begin() const {
+  return const_iterator(this->values, this->links.data(), this->head);
+}
+
+template <typename T>
+typename CompactLinkedList<T>::const_iterator CompactLinkedList<T>::end() const {
+  return const_iterator(this->values, this->links.data(), none);
+}
+
+template <typename T>
+typename CompactLinkedList<T>::const_iterator CompactLinkedList<T>::cbegin() const {
+  return this->begin();
+}
+
+template <typename T>
+typename CompactLinkedList<T>::const_iterator CompactLinkedList<T>::cend() const {
+  return this->end();
+}
+
+template <typename T>
+const bool CompactLinkedList<T>::operator==(const CompactLinkedList& other) const {
+  if (this == &other) return true;
+  if (this->length != other.length) return false;
+  if (this->ordered && other.ordered)
+    return BlockSearch<T>::equal(this->values, other.values, this->length);
+  uint32_t otherSlot = other.head;
+  for (uint32_t slot = this->head; slot != none; slot = this->links[slot]) {
+    if (this->values[slot] != other.values[otherSlot]) return false;
+    otherSlot = other.links[otherSlot];
+  }
+  return true;
+}
+
+template <typename T>
+const bool CompactLinkedList<T>::operator!=(const CompactLinkedList& other) const {
+  return !this->operator==(other);
+}
+
+template <typename T>
+const T& CompactLinkedList<T>::operator[](const std::size_t index) const {
+  if (index >= this->length) throw ListIndexOutOfBounds(index, this->length);
+  return this->values[this->slotAt(index)];
+}
+
+template <typename T>
+T& CompactLinkedList<T>::operator[](const std::size_t index) {
+  if (index >= this->length) throw ListIndexOutOfBounds(index, this->length);
+  return this->values[this->slotAt(index)];
+}
+
+template <typename T>
+template <typename... Args>
+CompactLinkedList<T>& CompactLinkedList<T>::emplace(const std::size_t index, Args&&... args) {
+  if (index > this->length) throw ListIndexOutOfBounds(index, this->length);
+  uint32_t prior = index ? this->slotAt(index - 1) : none;
+  uint32_t slot = this->createSlot(std::forward<Args>(args)...);
+  if (prior == none) {
+    this->links[slot] = this->head;
+    this->head = slot;
+  } else {
+    this->links[slot] = this->links[prior];
+    this->links[prior] = slot;
+  }
+  if (index == this->length) this->tail = slot;
+  this->ordered = this->ordered && index == this->length && slot == this->length;
+  ++this->length;
+  return *this;
+}
+
+// Constructs an element in a free slot, reusing removed slots first and
+// doubling the storage when it is full. When growing, the new element is
+// built before the old ones move, so the arguments may refer into the list.
+template <typename T>
+template <typename... Args>
+uint32_t CompactLinkedList<T>::createSlot(Args&&... args) {
+  uint32_t slot = this->freeSlot;
+  if (slot != none) {
+    Traits::construct(this->allocator, this->values + slot, std::forward<Args>(args)...);
+    this->freeSlot = this->links[slot];
+    return slot;
+  }
+  slot = this->links.size();
+  if (slot < this->slots) {
+    Traits::construct(this->allocator, this->values + slot, std::forward<Args>(args)...);
+  } else {
+    if (slot == none) throw std::length_error("CompactLinkedList is limited to 2^32 - 1 elements");
+    const std::size_t count = std::min<std::size_t>(std::max<std::size_t>(8, 2 * this->slots), none);
+    T* moved = this->allocateSlots(count);
+    try {
+      Traits::construct(this->allocator, moved + slot, std::forward<Args>(args)...);
+    } catch (...) {
+      Traits::deallocate(this->allocator, moved, count);
+      throw;
+    }
+    try {
+      this->relocate(moved, false);
+    } catch (...) {
+      Traits::destroy(this->allocator, moved + slot);
+      Traits::deallocate(this->allocator, moved, count);
+      throw;
+    }
+    this->adoptSlots(moved, count);
+  }
+  this->links.push_back(none);
+  return slot;
+}
+
+template <typename T>
+void CompactLinkedList<T>::destroySlot(uint32_t slot) {
+  Traits::destroy(this->allocator, this->values + slot);
+  this->links[slot] = this->freeSlot;
+  this->freeSlot = slot;
+}
+
+template <typename T>
+uint32_t CompactLinkedList<T>::slotAt(const std::size_t index) const {
+  if (this->ordered) return index;
+  if (index == this->length - 1) return this->tail;
+  uint32_t slot = this->head;
+  for (std::size_t position = 0; position < index; ++position) slot = this->links[slot];
+  return slot;
+}
+
+// Unlinks `slot`, whose predecessor is `prior` (none for the head).
+template <typename T>
+T CompactLinkedList<T>::release(uint32_t prior, uint32_t slot) {
+  T data = std::move(this->values[slot]);
+  uint32_t next = this->links[slot];
+  if (prior == none)
+    this->head = next;
+  else
+    this->links[prior] = next;
+  if (next == none) this->tail = prior;
+  this->ordered = this->ordered && next == none;
+  this->destroySlot(slot);
+  if (--this->length == 0) this->clear();
+  return data;
+}
+
+// Threads the links through slots 0 to length - 1, for elements that already
+// sit in list order.
+template <typename T>
+void CompactLinkedList<T>::linkInOrder() {
+  this->links.resize(this->length);
+  for (std::size_t slot = 0; slot < this->length; ++slot) this->links[slot] = slot + 1;
+  if (this->length) {
+    this->links.back() = none;
+    this->head = 0;
+    this->tail = this->length - 1;
+  }
+  this->freeSlot = none;
+  this->ordered = true;
+}
+
+// Reads the elements straight into the reserved storage and links them in
+// order.
+template <typename T>
+void CompactLinkedList<T>::readFrom(ListFileReader<T>& reader, std::true_type) {
+  reader.read(this->values, reader.size());
+  this->length = reader.size();
+  this->linkInOrder();
+}
+
+template <typename T>
+void CompactLinkedList<T>::readFrom(ListFileReader<T>& reader, std::false_type) {
+  for (std::size_t i = 0; i < reader.size(); ++i) this->append(reader.next());
+}
+
+// Allocates storage for `count` elements and makes sure the link array can
+// grow to match without allocating again.
+template <typename T>
+T* CompactLinkedList<T>::allocateSlots(const std::size_t count) {
+  if (count > none) throw std::length_error("CompactLinkedList is limited to 2^32 - 1 elements");
+  this->links.reserve(count);
+  return Traits::allocate(this->allocator, count);
+}
+
+// Switches to storage the live elements were relocated into.
+template <typename T>
+void CompactLinkedList<T>::adoptSlots(T* storage, const std::size_t count) {
+  if (this->values) Traits::deallocate(this->allocator, this->values, this->slots);
+  this->values = storage;
+  this->slots = count;
+}
+
+// Move-constructs the live elements into `target`, either at the same slots
+// or, when `packing`, in list order from slot 0, then destroys the originals.
+// If a move throws, whatever was built in `target` is destroyed and the list
+// is unchanged.
+template <typename T>
+void CompactLinkedList<T>::relocate(T* target, const bool packing) {
+  uint32_t slot = this->head;
+  std::size_t position = 0;
+  try {
+    for (; slot != none; slot = this->links[slot], ++position)
+      Traits::construct(this->allocator, target + (packing ? position : slot),
+                        std::move_if_noexcept(this->values[slot]));
+  } catch (...) {
+    for (uint32_t done = this->head; done != slot; done = this->links[done], --position)
+      Traits::destroy(this->allocator, target + (packing ? position - 1 : done));
+    throw;
+  }
+  for (slot = this->head; slot != none; slot = this->links[slot])
+    Traits::destroy(this->allocator, this->values + slot);
+}
+
+#endif
@@ -0,0 +1,61 @@
+#ifndef COMPACTLINKEDLISTITERATOR_HPP
+#define COMPACTLINKEDLISTITERATOR_HPP
+
+#include <stddef.h>
+#include <stdint.h>
+#include <iterator>
+#include <type_traits>
+
+// Forward iterator over a CompactLinkedList: a slot index plus the list's
+// value and link arrays. Growing the list moves the arrays, so insertions
+// invalidate iterators.
+template <typename T, bool Const = false>
+class CompactLinkedListIterator {
+ public:
+  using iterator_category = std::forward_iterator_tag;
+  using value_type = T;
+  using difference_type = std::ptrdiff_t;
+  using pointer = typename std::conditional<Const, const T*, T*>::type;
+  using reference = typename std::conditional<Const, const T&, T&>::type;
+
+  CompactLinkedListIterator() : values(nullptr), links(nullptr), slot(UINT32_MAX) {}
+  CompactLinkedListIterator(T* values, const uint32_t* links, uint32_t slot)
+      : values(values), links(links), slot(slot) {}
+  template <bool OtherConst, typename = typename std::enable_if<Const && !OtherConst>::type>
+  CompactLinkedListIterator(const CompactLinkedListIterator<T, OtherConst>& other)
+      : values(other.values), links(other.links), slot(other.slot) {}
+
+  CompactLinkedListIterator& operator++() {
+    this->slot = this->links[this->slot];
+    return *this;
+  }
+  CompactLinkedListIterator operator++(int) {
+    CompactLinkedListIterator previous = *this;
+    this->slot = this->links[this->slot];
+    return previous;
+  }
+  reference operator*() const {
+    return this->values[this->slot];
+  }
+  pointer operator->() const {
+    return &this->values[this->slot];
+  }
+  template <bool OtherConst>
+  const bool operator==(const CompactLinkedListIterator<T, OtherConst>& other) const {
+    return this->slot == other.slot;
+  }
+  template <bool OtherConst>
+  const bool operator!=(const CompactLinkedListIterator<T, OtherConst>& other) const {
+    return this->slot != other.slot;
+  }
+
+ private:
+  template <typename, bool>
+  friend class CompactLinkedListIterator;
+
+  T* values;
+  const uint32_t* links;
+  uint32_t slot;
+};
+
+#endif
@@ -0,0 +1,149 @@
+#ifndef CONCURRENTLINKEDQUEUE_HPP
+#define CONCURRENTLINKEDQUEUE_HPP
+
+#include <stddef.h>
+#include <atomic>
+#include <type_traits>
+#include <utility>
+#include "ConcurrentNode.hpp"
+#include "HazardPointer.hpp"
+
+// Lock-free multi-producer multi-consumer FIFO queue (Michael & Scott). `push`
+// is the concurrent counterpart of LinkedList::append and `tryPop` of
+// LinkedList::unprepend. The head always points at a sentinel whose successor
+// holds the front element. Dequeued sentinels are reclaimed through the global
+// HazardPointerDomain, so a node is never freed while another thread may
+// still dereference it.
+template <typename T>
+class ConcurrentLinkedQueue {
+  // tryPop moves the element out after unlinking its node, when it can no
+  // longer be put back, so that move must not throw.
+  static_assert(std::is_nothrow_move_assignable<T>::value,
+                "ConcurrentLinkedQueue needs a nothrow move-assignable T");
+
+ public:
+  // Constructors
+  ConcurrentLinkedQueue();
+  ConcurrentLinkedQueue(const ConcurrentLinkedQueue&) = delete;
+  ConcurrentLinkedQueue& operator=(const ConcurrentLinkedQueue&) = delete;
+  ~ConcurrentLinkedQueue();
+
+  // Getters
+  const bool isEmpty() const;
+  const std::size_t size() const;
+
+  // Mutators
+  void push(const T&);
+  void push(T&&);
+  const bool tryPop(T&);
+
+ private:
+  template <typename... Args>
+  void enqueue(Args&&...);
+  static void reclaim(void*);
+
+  alignas(64) std::atomic<ConcurrentNode<T>*> head;
+  alignas(64) std::atomic<ConcurrentNode<T>*> tail;
+  alignas(64) std::atomic<std::size_t> length;
+};
+
+template <typename T>
+ConcurrentLinkedQueue<T>::ConcurrentLinkedQueue() : length(0) {
+  ConcurrentNode<T>* sentinel = new ConcurrentNode<T>();
+  this->head.store(sentinel);
+  this->tail.store(sentinel);
+}
+
+// Not thread safe: no other thread may use the queue while it is destroyed.
+template <typename T>
+ConcurrentLinkedQueue<T>::~ConcurrentLinkedQueue() {
+  ConcurrentNode<T>* sentinel = this->head.load();
+  ConcurrentNode<T>* current = sentinel->next.load();
+  delete sentinel;
+  while (current) {
+    ConcurrentNode<T>* next = current->next.load();
+    current->data().~T();
+    delete current;
+    current = next;
+  }
+}
+
+template <typename T>
+const bool ConcurrentLinkedQueue<T>::isEmpty() const {
+  return this->head.load()->next.load() == nullptr;
+}
+
+// Approximate while other threads are pushing or popping.
+template <typename T>
+const std::size_t ConcurrentLinkedQueue<T>::size() const {
+  return this->length.load(std::memory_order_relaxed);
+}
+
+template <typename T>
+void ConcurrentLinkedQueue<T>::push(const T& data) {
+  this->enqueue(data);
+}
+
+template <typename T>
+void ConcurrentLinkedQueue<T>::push(T&& data) {
+  this->enqueue(std::move(data));
+}
+
+template <typename T>
+const bool ConcurrentLinkedQueue<T>::tryPop(T& data) {
+  HazardPointerDomain& hazards = HazardPointerDomain::global();
+  while (true) {
+    ConcurrentNode<T>* first = hazards.protect(0, this->head);
+    ConcurrentNode<T>* last = this->tail.load();
+    ConcurrentNode<T>* next = hazards.protect(1, first->next);
+    if (first != this->head.load()) continue;
+    if (!next) {
+      hazards.clear(0);
+      hazards.clear(1);
+      return false;
+    }
+    if (first == last) {
+      // Tail is lagging behind a half-finished push; help it along.
+      this->tail.compare_exchange_strong(last, next);
+      continue;
+    }
+    if (this->head.compare_exchange_strong(first, next)) {
+      // `next` is the new sentinel; only the winning thread touches its value.
+      data = std::move(next->data());
+      next->data().~T();
+      hazards.clear(0);
+      hazards.clear(1);
+      hazards.retire(first, &ConcurrentLinkedQueue<T>::reclaim);
+      this->length.fetch_sub(1, std::memory_order_relaxed);
+      return true;
+    }
+  }
+}
+
+template <typename T>
+template <typename... Args>
+void ConcurrentLinkedQueue<T>::enqueue(Args&&... args) {
+  ConcurrentNode<T>* node = new ConcurrentNode<T>(std::forward<Args>(args)...);
+  HazardPointerDomain& hazards = HazardPointerDomain::global();
+  // Count before publishing so a racing tryPop never drives length below zero.
+  this->length.fetch_add(1, std::memory_order_relaxed);
+  while (true) {
+    ConcurrentNode<T>* last = hazards.protect(0, this->tail);
+    ConcurrentNode<T>* next = last->next.load();
+    if (last != this->tail.load()) continue;
+    if (next) {
+      this->tail.compare_exchange_strong(last, next);
+    } else if (last->next.compare_exchange_weak(next, node)) {
+      this->tail.compare_exchange_strong(last, node);
+      break;
+    }
+  }
+  hazards.clear(0);
+}
+
+template <typename T>
+void ConcurrentLinkedQueue<T>::reclaim(void* node) {
+  delete static_cast<ConcurrentNode<T>*>(node);
+}
+
+#endif
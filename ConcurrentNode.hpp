@@ -0,0 +1,37 @@
+#ifndef CONCURRENTNODE_HPP
+#define CONCURRENTNODE_HPP
+
+#include <atomic>
+#include <new>
+#include <utility>
+
+// Node of the lock-free queue. The payload lives in raw storage so that the
+// sentinel node needs no value and a popped value can be moved out and
+// destroyed while the node itself waits for reclamation.
+template <typename T>
+struct ConcurrentNode {
+  alignas(T) unsigned char storage[sizeof(T)];
+  std::atomic<ConcurrentNode*> next;
+
+  ConcurrentNode();
+  template <typename... Args>
+  explicit ConcurrentNode(Args&&...);
+
+  T& data();
+};
+
+template <typename T>
+ConcurrentNode<T>::ConcurrentNode() : next(nullptr) {}
+
+template <typename T>
+template <typename... Args>
+ConcurrentNode<T>::ConcurrentNode(Args&&... args) : next(nullptr) {
+  new (this->storage) T(std::forward<Args>(args)...);
+}
+
+template <typename T>
+T& ConcurrentNode<T>::data() {
+  return *std::launder(reinterpret_cast<T*>(this->storage));
+}
+
+#endif
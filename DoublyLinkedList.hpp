@@ -0,0 +1,346 @@
+#ifndef DOUBLYLINKEDLIST_HPP
+#define DOUBLYLINKEDLIST_HPP
+
+#include <stddef.h>
+#include <initializer_list>
+#include <memory>
+#include <ostream>
+#include <utility>
+#include "DoublyLinkedListIterator.hpp"
+#include "DoublyNode.hpp"
+#include "ListIndexOutOfBounds.hpp"
+
+template <typename T, typename Allocator = std::allocator<T>>
+class DoublyLinkedList {
+ public:
+  // Constructors
+  DoublyLinkedList();
+  explicit DoublyLinkedList(const Allocator&);
+  DoublyLinkedList(const T&, const Allocator& = Allocator());
+  DoublyLinkedList(const std::initializer_list<T>, const Allocator& = Allocator());
+  DoublyLinkedList(const DoublyLinkedList&);
+  DoublyLinkedList& operator=(const DoublyLinkedList&);
+  ~DoublyLinkedList();
+
+  // Getters
+  const T& getHead() const;
+  const T& getTail() const;
+  const bool isEmpty() const;
+  const bool contains(const T&) const;
+  const std::size_t size() const;
+  Allocator getAllocator() const;
+
+  // Mutators
+  DoublyLinkedList<T, Allocator>& append(const T&);
+  DoublyLinkedList<T, Allocator>& prepend(const T&);
+  DoublyLinkedList<T, Allocator>& insert(const T&, const std::size_t);
+  T unappend();
+  T unprepend();
+  T remove(const std::size_t);
+  DoublyLinkedList<T, Allocator>& remove(const T&, const std::size_t);
+  void clear();
+
+  // Iterators
+  DoublyLinkedListIterator<T> begin() const;
+  DoublyLinkedListIterator<T> end() const;
+
+  // Operators
+  const bool operator==(const DoublyLinkedList&) const;
+  const bool operator!=(const DoublyLinkedList&) const;
+  const T& operator[](const std::size_t) const;
+  T& operator[](const std::size_t);
+
+  // Friend Operator
+  friend std::ostream& operator<<(std::ostream& output,
+                                  const DoublyLinkedList& self) {
+    DoublyNode<T>* current = self.head;
+    output << "[";
+    if (current) {
+      while (current->next) {
+        output << current->data << "<->";
+        current = current->next;
+      }
+      output << current->data;
+    }
+    output << "]";
+    return output;
+  }
+
+ private:
+  using NodeAllocator =
+      typename std::allocator_traits<Allocator>::template rebind_alloc<DoublyNode<T>>;
+  using NodeTraits = std::allocator_traits<NodeAllocator>;
+
+  DoublyNode<T>* nodeAt(const std::size_t) const;
+  T unlink(DoublyNode<T>*);
+  DoublyNode<T>* createNode(const T&);
+  void destroyNode(DoublyNode<T>*);
+
+  DoublyNode<T>* head;
+  DoublyNode<T>* tail;
+  std::size_t length;
+  NodeAllocator allocator;
+};
+
+template <typename T, typename Allocator>
+DoublyLinkedList<T, Allocator>::DoublyLinkedList()
+    : head(nullptr), tail(nullptr), length(0), allocator() {}
+
+template <typename T, typename Allocator>
+DoublyLinkedList<T, Allocator>::DoublyLinkedList(const Allocator& allocator)
+    : head(nullptr), tail(nullptr), length(0), allocator(allocator) {}
+
+template <typename T, typename Allocator>
+DoublyLinkedList<T, Allocator>::DoublyLinkedList(const T& data, const Allocator& allocator)
+    : head(nullptr), tail(nullptr), length(0), allocator(allocator) {
+  this->append(data);
+}
+
+template <typename T, typename Allocator>
+DoublyLinkedList<T, Allocator>::DoublyLinkedList(const std::initializer_list<T> args,
+                                                 const Allocator& allocator)
+    : head(nullptr), tail(nullptr), length(0), allocator(allocator) {
+  for (const T& data : args) this->append(data);
+}
+
+template <typename T, typename Allocator>
+DoublyLinkedList<T, Allocator>::DoublyLinkedList(const DoublyLinkedList& other)
+    : head(nullptr),
+      tail(nullptr),
+      length(0),
+      allocator(NodeTraits::select_on_container_copy_construction(other.allocator)) {
+  for (DoublyNode<T>* current = other.head; current; current = current->next)
+    this->append(current->data);
+}
+
+template <typename T, typename Allocator>
+DoublyLinkedList<T, Allocator>& DoublyLinkedList<T, Allocator>::operator=(
+    const DoublyLinkedList& other) {
+  if (this != &other) {
+    this->clear();
+    for (DoublyNode<T>* current = other.head; current; current = current->next)
+      this->append(current->data);
+  }
+  return *this;
+}
+
+template <typename T, typename Allocator>
+DoublyLinkedList<T, Allocator>::~DoublyLinkedList() {
+  this->clear();
+}
+
+template <typename T, typename Allocator>
+const T& DoublyLinkedList<T, Allocator>::getHead() const {
+  if (this->isEmpty()) throw ListIndexOutOfBounds();
+  return this->head->data;
+}
+
+template <typename T, typename Allocator>
+const T& DoublyLinkedList<T, Allocator>::getTail() const {
+  if (this->isEmpty()) throw ListIndexOutOfBounds();
+  return this->tail->data;
+}
+
+template <typename T, typename Allocator>
+const bool DoublyLinkedList<T, Allocator>::isEmpty() const {
+  return this->head == nullptr && this->tail == nullptr;
+}
+
+template <typename T, typename Allocator>
+const bool DoublyLinkedList<T, Allocator>::contains(const T& data) const {
+  for (DoublyNode<T>* current = this->head; current; current = current->next)
+    if (current->data == data) return true;
+  return false;
+}
+
+template <typename T, typename Allocator>
+const std::size_t DoublyLinkedList<T, Allocator>::size() const {
+  return this->length;
+}
+
+template <typename T, typename Allocator>
+Allocator DoublyLinkedList<T, Allocator>::getAllocator() const {
+  return Allocator(this->allocator);
+}
+
+template <typename T, typename Allocator>
+DoublyLinkedList<T, Allocator>& DoublyLinkedList<T, Allocator>::append(const T& data) {
+  DoublyNode<T>* back = this->createNode(data);
+  back->prev = this->tail;
+  if (this->isEmpty())
+    this->head = back;
+  else
+    this->tail->next = back;
+  this->tail = back;
+  ++this->length;
+  return *this;
+}
+
+template <typename T, typename Allocator>
+DoublyLinkedList<T, Allocator>& DoublyLinkedList<T, Allocator>::prepend(const T& data) {
+  DoublyNode<T>* front = this->createNode(data);
+  front->next = this->head;
+  if (this->isEmpty())
+    this->tail = front;
+  else
+    this->head->prev = front;
+  this->head = front;
+  ++this->length;
+  return *this;
+}
+
+template <typename T, typename Allocator>
+DoublyLinkedList<T, Allocator>& DoublyLinkedList<T, Allocator>::insert(
+    const T& data, const std::size_t index) {
+  if (index > this->length) throw ListIndexOutOfBounds(index, this->length);
+  if (index == 0)
+    return this->prepend(data);
+  else if (index == this->length)
+    return this->append(data);
+  DoublyNode<T>* after = this->nodeAt(index);
+  DoublyNode<T>* toAdd = this->createNode(data);
+  toAdd->prev = after->prev;
+  toAdd->next = after;
+  after->prev->next = toAdd;
+  after->prev = toAdd;
+  ++this->length;
+  return *this;
+}
+
+template <typename T, typename Allocator>
+T DoublyLinkedList<T, Allocator>::unappend() {
+  if (this->isEmpty()) throw ListIndexOutOfBounds(0, 0);
+  return this->unlink(this->tail);
+}
+
+template <typename T, typename Allocator>
+T DoublyLinkedList<T, Allocator>::unprepend() {
+  if (this->isEmpty()) throw ListIndexOutOfBounds(0, 0);
+  return this->unlink(this->head);
+}
+
+template <typename T, typename Allocator>
+T DoublyLinkedList<T, Allocator>::remove(const std::size_t index) {
+  if (index >= this->length) throw ListIndexOutOfBounds(index, this->length);
+  return this->unlink(this->nodeAt(index));
+}
+
+template <typename T, typename Allocator>
+DoublyLinkedList<T, Allocator>& DoublyLinkedList<T, Allocator>::remove(
+    const T& data, const std::size_t num) {
+  std::size_t numRemoved = 0;
+  DoublyNode<T>* current = this->head;
+  while (numRemoved < num && current) {
+    DoublyNode<T>* next = current->next;
+    if (current->data == data) {
+      this->unlink(current);
+      ++numRemoved;
+    }
+    current = next;
+  }
+  return *this;
+}
+
+template <typename T, typename Allocator>
+void DoublyLinkedList<T, Allocator>::clear() {
+  while (this->head) {
+    DoublyNode<T>* next = this->head->next;
+    this->destroyNode(this->head);
+    this->head = next;
+  }
+  this->tail = nullptr;
+  this->length = 0;
+}
+
+template <typename T, typename Allocator>
+DoublyLinkedListIterator<T> DoublyLinkedList<T, Allocator>::begin() const {
+  return DoublyLinkedListIterator<T>(this->head, this->tail);
+}
+
+template <typename T, typename Allocator>
+DoublyLinkedListIterator<T> DoublyLinkedList<T, Allocator>::end() const {
+  return DoublyLinkedListIterator<T>(nullptr, this->tail);
+}
+
+template <typename T, typename Allocator>
+const bool DoublyLinkedList<T, Allocator>::operator==(const DoublyLinkedList& other) const {
+  if (this == &other) return true;
+  if (this->length != other.length) return false;
+  DoublyNode<T>* thisCurrent = this->head;
+  DoublyNode<T>* otherCurrent = other.head;
+  while (thisCurrent) {
+    if (thisCurrent->data != otherCurrent->data) return false;
+    thisCurrent = thisCurrent->next;
+    otherCurrent = otherCurrent->next;
+  }
+  return true;
+}
+
+template <typename T, typename Allocator>
+const bool DoublyLinkedList<T, Allocator>::operator!=(const DoublyLinkedList& other) const {
+  return !this->operator==(other);
+}
+
+template <typename T, typename Allocator>
+const T& DoublyLinkedList<T, Allocator>::operator[](const std::size_t index) const {
+  if (index >= this->length) throw ListIndexOutOfBounds(index, this->length);
+  return this->nodeAt(index)->data;
+}
+
+template <typename T, typename Allocator>
+T& DoublyLinkedList<T, Allocator>::operator[](const std::size_t index) {
+  if (index >= this->length) throw ListIndexOutOfBounds(index, this->length);
+  return this->nodeAt(index)->data;
+}
+
+// Walks from whichever end is closer to the index.
+template <typename T, typename Allocator>
+DoublyNode<T>* DoublyLinkedList<T, Allocator>::nodeAt(const std::size_t index) const {
+  DoublyNode<T>* current;
+  if (index < this->length / 2) {
+    current = this->head;
+    for (std::size_t position = 0; position < index; ++position)
+      current = current->next;
+  } else {
+    current = this->tail;
+    for (std::size_t position = this->length - 1; position > index; --position)
+      current = current->prev;
+  }
+  return current;
+}
+
+template <typename T, typename Allocator>
+T DoublyLinkedList<T, Allocator>::unlink(DoublyNode<T>* node) {
+  if (node->prev)
+    node->prev->next = node->next;
+  else
+    this->head = node->next;
+  if (node->next)
+    node->next->prev = node->prev;
+  else
+    this->tail = node->prev;
+  T data = std::move(node->data);
+  this->destroyNode(node);
+  --this->length;
+  return data;
+}
+
+template <typename T, typename Allocator>
+DoublyNode<T>* DoublyLinkedList<T, Allocator>::createNode(const T& data) {
+  DoublyNode<T>* node = NodeTraits::allocate(this->allocator, 1);
+  try {
+    NodeTraits::construct(this->allocator, node, data);
+  } catch (...) {
+    NodeTraits::deallocate(this->allocator, node, 1);
+    throw;
+  }
+  return node;
+}
+
+template <typename T, typename Allocator>
+void DoublyLinkedList<T, Allocator>::destroyNode(DoublyNode<T>* node) {
+  NodeTraits::destroy(this->allocator, node);
+  NodeTraits::deallocate(this->allocator, node, 1);
+}
+
+#endif
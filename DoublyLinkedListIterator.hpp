@@ -0,0 +1,57 @@
+#ifndef DOUBLYLINKEDLISTITERATOR_HPP
+#define DOUBLYLINKEDLISTITERATOR_HPP
+
+#include <stddef.h>
+#include <iterator>
+#include "DoublyNode.hpp"
+
+// Bidirectional iterator. Keeps the list's last node so that decrementing the
+// past-the-end iterator lands on the tail.
+template <typename T>
+class DoublyLinkedListIterator {
+ public:
+  using iterator_category = std::bidirectional_iterator_tag;
+  using value_type = T;
+  using difference_type = std::ptrdiff_t;
+  using pointer = T*;
+  using reference = T&;
+
+  DoublyLinkedListIterator() : current(nullptr), last(nullptr) {}
+  DoublyLinkedListIterator(DoublyNode<T>* start, DoublyNode<T>* last)
+      : current(start), last(last) {}
+  DoublyLinkedListIterator<T>& operator++() {
+    this->current = this->current->next;
+    return *this;
+  }
+  DoublyLinkedListIterator<T>& operator--() {
+    this->current = this->current ? this->current->prev : this->last;
+    return *this;
+  }
+  DoublyLinkedListIterator<T> operator++(int) {
+    DoublyLinkedListIterator<T> previous = *this;
+    this->operator++();
+    return previous;
+  }
+  DoublyLinkedListIterator<T> operator--(int) {
+    DoublyLinkedListIterator<T> previous = *this;
+    this->operator--();
+    return previous;
+  }
+  T& operator*() const {
+    return this->current->data;
+  }
+  T* operator->() const {
+    return &this->current->data;
+  }
+  const bool operator==(const DoublyLinkedListIterator<T>& other) const {
+    return this->current == other.current;
+  }
+  const bool operator!=(const DoublyLinkedListIterator<T>& other) const {
+    return this->current != other.current;
+  }
+ private:
+  DoublyNode<T>* current;
+  DoublyNode<T>* last;
+};
+
+#endif
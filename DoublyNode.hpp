@@ -0,0 +1,22 @@
+#ifndef DOUBLYNODE_HPP
+#define DOUBLYNODE_HPP
+
+#include <ostream>
+
+template <typename T>
+struct DoublyNode {
+  T data;
+  DoublyNode* prev;
+  DoublyNode* next;
+  DoublyNode(const T&);
+
+  friend std::ostream& operator<<(std::ostream& output, const DoublyNode& self) {
+    output << "Data: " << self.data << "Prev: " << self.prev << "Next: " << self.next;
+    return output;
+  }
+};
+
+template <typename T>
+DoublyNode<T>::DoublyNode(const T& data) : data(data), prev(nullptr), next(nullptr) {}
+
+#endif
@@ -0,0 +1,160 @@
+#ifndef HAZARDPOINTER_HPP
+#define HAZARDPOINTER_HPP
+
+#include <stddef.h>
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+// Process-wide hazard pointer domain used for safe memory reclamation in the
+// lock-free containers. Each thread owns a few hazard slots; a node published
+// in any slot is never freed. Retired nodes are kept on a per-thread list and
+// freed in batches once no slot refers to them. Nodes still retired when their
+// thread exits are handed to the domain and reclaimed by the next scan.
+class HazardPointerDomain {
+ public:
+  static constexpr std::size_t hazardsPerThread = 2;
+
+  static HazardPointerDomain& global();
+  ~HazardPointerDomain();
+
+  // Publishes the pointer read from `source` in the calling thread's slot and
+  // returns it once the publication is known to have happened before any
+  // concurrent retire of that pointer.
+  template <typename P>
+  P* protect(const std::size_t, const std::atomic<P*>&);
+  void clear(const std::size_t);
+  void retire(void*, void (*)(void*));
+
+ private:
+  struct HazardRecord {
+    std::atomic<const void*> pointer;
+    std::atomic<bool> active;
+    HazardRecord* next;
+  };
+
+  struct Retired {
+    void* pointer;
+    void (*deleter)(void*);
+  };
+
+  struct ThreadState {
+    HazardRecord* records[hazardsPerThread];
+    std::vector<Retired> retired;
+    explicit ThreadState(HazardPointerDomain&);
+    ~ThreadState();
+  };
+
+  HazardPointerDomain();
+
+  ThreadState& local();
+  HazardRecord* acquire();
+  void scan(std::vector<Retired>&);
+
+  std::atomic<HazardRecord*> records;
+  std::atomic<std::size_t> recordCount;
+  std::mutex orphanMutex;
+  std::vector<Retired> orphans;
+};
+
+inline HazardPointerDomain::HazardPointerDomain() : records(nullptr), recordCount(0) {}
+
+inline HazardPointerDomain::~HazardPointerDomain() {
+  for (const Retired& retired : this->orphans) retired.deleter(retired.pointer);
+  HazardRecord* current = this->records.load();
+  while (current) {
+    HazardRecord* next = current->next;
+    delete current;
+    current = next;
+  }
+}
+
+inline HazardPointerDomain& HazardPointerDomain::global() {
+  static HazardPointerDomain domain;
+  return domain;
+}
+
+template <typename P>
+P* HazardPointerDomain::protect(const std::size_t slot, const std::atomic<P*>& source) {
+  HazardRecord* record = this->local().records[slot];
+  P* pointer = source.load();
+  while (true) {
+    record->pointer.store(pointer);
+    P* reread = source.load();
+    if (reread == pointer) return pointer;
+    pointer = reread;
+  }
+}
+
+inline void HazardPointerDomain::clear(const std::size_t slot) {
+  this->local().records[slot]->pointer.store(nullptr, std::memory_order_release);
+}
+
+inline void HazardPointerDomain::retire(void* pointer, void (*deleter)(void*)) {
+  std::vector<Retired>& retired = this->local().retired;
+  retired.push_back(Retired{pointer, deleter});
+  if (retired.size() >= 2 * this->recordCount.load(std::memory_order_relaxed) + 64)
+    this->scan(retired);
+}
+
+inline HazardPointerDomain::ThreadState::ThreadState(HazardPointerDomain& domain) {
+  for (HazardRecord*& record : this->records) record = domain.acquire();
+}
+
+inline HazardPointerDomain::ThreadState::~ThreadState() {
+  HazardPointerDomain& domain = HazardPointerDomain::global();
+  for (HazardRecord* record : this->records) {
+    record->pointer.store(nullptr);
+    record->active.store(false, std::memory_order_release);
+  }
+  domain.scan(this->retired);
+  std::lock_guard<std::mutex> lock(domain.orphanMutex);
+  domain.orphans.insert(domain.orphans.end(), this->retired.begin(), this->retired.end());
+}
+
+inline HazardPointerDomain::ThreadState& HazardPointerDomain::local() {
+  static thread_local ThreadState state(*this);
+  return state;
+}
+
+// Reuses a record released by an exited thread before growing the list.
+inline HazardPointerDomain::HazardRecord* HazardPointerDomain::acquire() {
+  for (HazardRecord* current = this->records.load(); current; current = current->next) {
+    bool expected = false;
+    if (!current->active.load(std::memory_order_relaxed) &&
+        current->active.compare_exchange_strong(expected, true))
+      return current;
+  }
+  HazardRecord* record = new HazardRecord();
+  record->pointer.store(nullptr);
+  record->active.store(true);
+  record->next = this->records.load();
+  while (!this->records.compare_exchange_weak(record->next, record)) {
+  }
+  ++this->recordCount;
+  return record;
+}
+
+inline void HazardPointerDomain::scan(std::vector<Retired>& retired) {
+  {
+    std::unique_lock<std::mutex> lock(this->orphanMutex, std::try_to_lock);
+    if (lock.owns_lock() && !this->orphans.empty()) {
+      retired.insert(retired.end(), this->orphans.begin(), this->orphans.end());
+      this->orphans.clear();
+    }
+  }
+  std::vector<const void*> hazards;
+  for (HazardRecord* current = this->records.load(); current; current = current->next)
+    if (const void* pointer = current->pointer.load()) hazards.push_back(pointer);
+  std::sort(hazards.begin(), hazards.end());
+  std::size_t kept = 0;
+  for (const Retired& candidate : retired)
+    if (std::binary_search(hazards.begin(), hazards.end(), candidate.pointer))
+      retired[kept++] = candidate;
+    else
+      candidate.deleter(candidate.pointer);
+  retired.resize(kept);
+}
+
+#endif
@@ -0,0 +1,477 @@
+#ifndef INDEXEDLINKEDLIST_HPP
+#define INDEXEDLINKEDLIST_HPP
+
+#include <stddef.h>
+#include <algorithm>
+#include <functional>
+#include <initializer_list>
+#include <ostream>
+#include <unordered_map>
+#include <utility>
+#include "IndexedLinkedListIterator.hpp"
+#include "IndexedNode.hpp"
+#include "ListIndexOutOfBounds.hpp"
+
+// Doubly linked list that also keeps a hash index from each distinct value to
+// the nodes holding it, so contains, count and remove(value, num) take O(1)
+// average time (plus O(num) for the removal) instead of a scan. Elements keep
+// their insertion order. The nodes holding one value are chained together in
+// list order, and the index key of that chain points at its first node's
+// value rather than storing a copy. Elements are read-only: changing one in
+// place would leave it filed under its old value.
+template <typename T, typename Hash = std::hash<T>, typename KeyEqual = std::equal_to<T>>
+class IndexedLinkedList {
+ public:
+  using value_type = T;
+  using size_type = std::size_t;
+  using const_iterator = IndexedLinkedListIterator<T>;
+
+  // Constructors
+  IndexedLinkedList();
+  IndexedLinkedList(const T&);
+  IndexedLinkedList(const std::initializer_list<T>);
+  IndexedLinkedList(const IndexedLinkedList&);
+  IndexedLinkedList(IndexedLinkedList&&) noexcept;
+  IndexedLinkedList& operator=(const IndexedLinkedList&);
+  IndexedLinkedList& operator=(IndexedLinkedList&&) noexcept;
+  ~IndexedLinkedList();
+
+  // Getters
+  const T& getHead() const;
+  const T& getTail() const;
+  const bool isEmpty() const;
+  const bool contains(const T&) const;
+  const std::size_t count(const T&) const;
+  const std::size_t size() const;
+
+  // Mutators
+  IndexedLinkedList& append(const T&);
+  IndexedLinkedList& prepend(const T&);
+  IndexedLinkedList& insert(const T&, const std::size_t);
+  T unappend();
+  T unprepend();
+  T remove(const std::size_t);
+  IndexedLinkedList& remove(const T&, const std::size_t);
+  void clear();
+
+  // Iterators
+  const_iterator begin() const;
+  const_iterator end() const;
+
+  // Operators
+  const bool operator==(const IndexedLinkedList&) const;
+  const bool operator!=(const IndexedLinkedList&) const;
+  const T& operator[](const std::size_t) const;
+
+  // Friend Operator
+  friend std::ostream& operator<<(std::ostream& output, const IndexedLinkedList& self) {
+    IndexedNode<T>* current = self.head;
+    output << "[";
+    if (current) {
+      while (current->next) {
+        output << current->data << "->";
+        current = current->next;
+      }
+      output << current->data;
+    }
+    output << "]";
+    return output;
+  }
+
+ private:
+  // Chain of the nodes holding one value, in list order.
+  struct Bucket {
+    IndexedNode<T>* first;
+    IndexedNode<T>* last;
+    std::size_t count;
+  };
+
+  struct KeyHash {
+    Hash hash;
+    std::size_t operator()(const T* key) const { return this->hash(*key); }
+  };
+
+  struct KeyEquals {
+    KeyEqual equal;
+    bool operator()(const T* a, const T* b) const { return this->equal(*a, *b); }
+  };
+
+  using Index = std::unordered_map<const T*, Bucket, KeyHash, KeyEquals>;
+
+  IndexedNode<T>* nodeAt(const std::size_t) const;
+  void link(IndexedNode<T>*, IndexedNode<T>*);
+  void unlink(IndexedNode<T>*);
+  void attach(typename Index::iterator, IndexedNode<T>*, IndexedNode<T>*);
+  void detach(IndexedNode<T>*);
+  void rekey(typename Index::iterator);
+  T release(IndexedNode<T>*);
+
+  IndexedNode<T>* head;
+  IndexedNode<T>* tail;
+  std::size_t length;
+  Index index;
+};
+
+template <typename T, typename Hash, typename KeyEqual>
+IndexedLinkedList<T, Hash, KeyEqual>::IndexedLinkedList()
+    : head(nullptr), tail(nullptr), length(0) {}
+
+template <typename T, typename Hash, typename KeyEqual>
+IndexedLinkedList<T, Hash, KeyEqual>::IndexedLinkedList(const T& data) : IndexedLinkedList() {
+  this->append(data);
+}
+
+template <typename T, typename Hash, typename KeyEqual>
+IndexedLinkedList<T, Hash, KeyEqual>::IndexedLinkedList(const std::initializer_list<T> args)
+    : IndexedLinkedList() {
+  for (const T& data : args) this->append(data);
+}
+
+template <typename T, typename Hash, typename KeyEqual>
+IndexedLinkedList<T, Hash, KeyEqual>::IndexedLinkedList(const IndexedLinkedList& other)
+    : IndexedLinkedList() {
+  for (IndexedNode<T>* current = other.head; current; current = current->next)
+    this->append(current->data);
+}
+
+// The index keys point into the nodes, which move along with it.
+template <typename T, typename Hash, typename KeyEqual>
+IndexedLinkedList<T, Hash, KeyEqual>::IndexedLinkedList(IndexedLinkedList&& other) noexcept
+    : head(other.head), tail(other.tail), length(other.length), index(std::move(other.index)) {
+  other.head = nullptr;
+  other.tail = nullptr;
+  other.length = 0;
+  other.index.clear();
+}
+
+template <typename T, typename Hash, typename KeyEqual>
+IndexedLinkedList<T, Hash, KeyEqual>& IndexedLinkedList<T, Hash, KeyEqual>::operator=(
+    const IndexedLinkedList& other) {
+  if (this != &other) {
+    this->clear();
+    for (IndexedNode<T>* current = other.head; current; current = current->next)
+      this->append(current->data);
+  }
+  return *this;
+}
+
+template <typename T, typename Hash, typename KeyEqual>
+IndexedLinkedList<T, Hash, KeyEqual>& IndexedLinkedList<T, Hash, KeyEqual>::operator=(
+    IndexedLinkedList&& other) noexcept {
+  if (this != &other) {
+    this->clear();
+    std::swap(this->head, other.head);
+    std::swap(this->tail, other.tail);
+    std::swap(this->length, other.length);
+    std::swap(this->index, other.index);
+  }
+  return *this;
+}
+
+template <typename T, typename Hash, typename KeyEqual>
+IndexedLinkedList<T, Hash, KeyEqual>::~IndexedLinkedList() {
+  this->clear();
+}
+
+template <typename T, typename Hash, typename KeyEqual>
+const T& IndexedLinkedList<T, Hash, KeyEqual>::getHead() const {
+  if (this->isEmpty()) throw ListIndexOutOfBounds();
+  return this->head->data;
+}
+
+template <typename T, typename Hash, typename KeyEqual>
+const T& IndexedLinkedList<T, Hash, KeyEqual>::getTail() const {
+  if (this->isEmpty()) throw ListIndexOutOfBounds();
+  return this->tail->data;
+}
+
+template <typename T, typename Hash, typename KeyEqual>
+const bool IndexedLinkedList<T, Hash, KeyEqual>::isEmpty() const {
+  return this->head == nullptr && this->tail == nullptr;
+}
+
+template <typename T, typename Hash, typename KeyEqual>
+const bool IndexedLinkedList<T, Hash, KeyEqual>::contains(const T& data) const {
+  return this->index.find(&data) != this->index.end();
+}
+
+template <typename T, typename Hash, typename KeyEqual>
+const std::size_t IndexedLinkedList<T, Hash, KeyEqual>::count(const T& data) const {
+  auto found = this->index.find(&data);
+  return found == this->index.end() ? 0 : found->second.count;
+}
+
+template <typename T, typename Hash, typename KeyEqual>
+const std::size_t IndexedLinkedList<T, Hash, KeyEqual>::size() const {
+  return this->length;
+}
+
+template <typename T, typename Hash, typename KeyEqual>
+IndexedLinkedList<T, Hash, KeyEqual>& IndexedLinkedList<T, Hash, KeyEqual>::append(
+    const T& data) {
+  IndexedNode<T>* back = new IndexedNode<T>(data);
+  this->attach(this->index.find(&back->data), back, nullptr);
+  this->link(back, this->tail);
+  return *this;
+}
+
+template <typename T, typename Hash, typename KeyEqual>
+IndexedLinkedList<T, Hash, KeyEqual>& IndexedLinkedList<T, Hash, KeyEqual>::prepend(
+    const T& data) {
+  IndexedNode<T>* front = new IndexedNode<T>(data);
+  auto found = this->index.find(&front->data);
+  this->attach(found, front, found == this->index.end() ? nullptr : found->second.first);
+  this->link(front, nullptr);
+  return *this;
+}
+
+// The walk to the insertion point also finds the nearest equal value on the
+// side it walks, which places the new node in its value's chain.
+template <typename T, typename Hash, typename KeyEqual>
+IndexedLinkedList<T, Hash, KeyEqual>& IndexedLinkedList<T, Hash, KeyEqual>::insert(
+    const T& data, const std::size_t position) {
+  if (position > this->length) throw ListIndexOutOfBounds(position, this->length);
+  if (position == 0)
+    return this->prepend(data);
+  else if (position == this->length)
+    return this->append(data);
+  IndexedNode<T>* toAdd = new IndexedNode<T>(data);
+  auto found = this->index.find(&toAdd->data);
+  const bool indexed = found != this->index.end();
+  KeyEqual equal;
+  IndexedNode<T>* prior;
+  IndexedNode<T>* successor = nullptr;
+  if (position < this->length / 2) {
+    IndexedNode<T>* equalBefore = nullptr;
+    prior = this->head;
+    for (std::size_t i = 1; i < position; ++i) {
+      if (indexed && equal(prior->data, data)) equalBefore = prior;
+      prior = prior->next;
+    }
+    if (indexed && equal(prior->data, data)) equalBefore = prior;
+    if (indexed) successor = equalBefore ? equalBefore->nextEqual : found->second.first;
+  } else {
+    IndexedNode<T>* after = this->tail;
+    for (std::size_t i = this->length - 1; i > position; --i) {
+      if (indexed && equal(after->data, data)) successor = after;
+      after = after->prev;
+    }
+    if (indexed && equal(after->data, data)) successor = after;
+    prior = after->prev;
+  }
+  this->attach(found, toAdd, successor);
+  this->link(toAdd, prior);
+  return *this;
+}
+
+template <typename T, typename Hash, typename KeyEqual>
+T IndexedLinkedList<T, Hash, KeyEqual>::unappend() {
+  if (this->isEmpty()) throw ListIndexOutOfBounds(0, 0);
+  return this->release(this->tail);
+}
+
+template <typename T, typename Hash, typename KeyEqual>
+T IndexedLinkedList<T, Hash, KeyEqual>::unprepend() {
+  if (this->isEmpty()) throw ListIndexOutOfBounds(0, 0);
+  return this->release(this->head);
+}
+
+template <typename T, typename Hash, typename KeyEqual>
+T IndexedLinkedList<T, Hash, KeyEqual>::remove(const std::size_t position) {
+  if (position >= this->length) throw ListIndexOutOfBounds(position, this->length);
+  return this->release(this->nodeAt(position));
+}
+
+// Removes the first `num` occurrences straight from the value's chain.
+template <typename T, typename Hash, typename KeyEqual>
+IndexedLinkedList<T, Hash, KeyEqual>& IndexedLinkedList<T, Hash, KeyEqual>::remove(
+    const T& data, const std::size_t num) {
+  auto found = this->index.find(&data);
+  if (found == this->index.end() || num == 0) return *this;
+  Bucket& bucket = found->second;
+  IndexedNode<T>* current = bucket.first;
+  IndexedNode<T>* rest = current;
+  const std::size_t numRemoved = std::min(num, bucket.count);
+  for (std::size_t i = 0; i < numRemoved; ++i) rest = rest->nextEqual;
+  // Settle the index before freeing the node its key points into.
+  if (rest) {
+    rest->prevEqual = nullptr;
+    bucket.first = rest;
+    bucket.count -= numRemoved;
+    this->rekey(found);
+  } else {
+    this->index.erase(found);
+  }
+  while (current != rest) {
+    IndexedNode<T>* next = current->nextEqual;
+    this->unlink(current);
+    delete current;
+    current = next;
+  }
+  return *this;
+}
+
+template <typename T, typename Hash, typename KeyEqual>
+void IndexedLinkedList<T, Hash, KeyEqual>::clear() {
+  this->index.clear();
+  while (this->head) {
+    IndexedNode<T>* next = this->head->next;
+    delete this->head;
+    this->head = next;
+  }
+  this->tail = nullptr;
+  this->length = 0;
+}
+
+template <typename T, typename Hash, typename KeyEqual>
+typename IndexedLinkedList<T, Hash, KeyEqual>::const_iterator
+IndexedLinkedList<T, Hash, KeyEqual>::begin() const {
+  return const_iterator(this->head);
+}
+
+template <typename T, typename Hash, typename KeyEqual>
+typename IndexedLinkedList<T, Hash, KeyEqual>::const_iterator
+IndexedLinkedList<T, Hash, KeyEqual>::end() const {
+  return const_iterator(nullptr);
+}
+
+template <typename T, typename Hash, typename KeyEqual>
+const bool IndexedLinkedList<T, Hash, KeyEqual>::operator==(
+    const IndexedLinkedList& other) const {
+  if (this == &other) return true;
+  if (this->length != other.length) return false;
+  IndexedNode<T>* thisCurrent = this->head;
+  IndexedNode<T>* otherCurrent = other.head;
+  while (thisCurrent) {
+    if (thisCurrent->data != otherCurrent->data) return false;
+    thisCurrent = thisCurrent->next;
+    otherCurrent = otherCurrent->next;
+  }
+  return true;
+}
+
+template <typename T, typename Hash, typename KeyEqual>
+const bool IndexedLinkedList<T, Hash, KeyEqual>::operator!=(
+    const IndexedLinkedList& other) const {
+  return !this->operator==(other);
+}
+
+template <typename T, typename Hash, typename KeyEqual>
+const T& IndexedLinkedList<T, Hash, KeyEqual>::operator[](const std::size_t position) const {
+  if (position >= this->length) throw ListIndexOutOfBounds(position, this->length);
+  return this->nodeAt(position)->data;
+}
+
+// Walks from whichever end is closer to the position.
+template <typename T, typename Hash, typename KeyEqual>
+IndexedNode<T>* IndexedLinkedList<T, Hash, KeyEqual>::nodeAt(const std::size_t position) const {
+  IndexedNode<T>* current;
+  if (position < this->length / 2) {
+    current = this->head;
+    for (std::size_t i = 0; i < position; ++i) current = current->next;
+  } else {
+    current = this->tail;
+    for (std::size_t i = this->length - 1; i > position; --i) current = current->prev;
+  }
+  return current;
+}
+
+// Links `node` into the list after `prior`, or at the front if it is null.
+template <typename T, typename Hash, typename KeyEqual>
+void IndexedLinkedList<T, Hash, KeyEqual>::link(IndexedNode<T>* node, IndexedNode<T>* prior) {
+  node->prev = prior;
+  node->next = prior ? prior->next : this->head;
+  if (node->prev)
+    node->prev->next = node;
+  else
+    this->head = node;
+  if (node->next)
+    node->next->prev = node;
+  else
+    this->tail = node;
+  ++this->length;
+}
+
+template <typename T, typename Hash, typename KeyEqual>
+void IndexedLinkedList<T, Hash, KeyEqual>::unlink(IndexedNode<T>* node) {
+  if (node->prev)
+    node->prev->next = node->next;
+  else
+    this->head = node->next;
+  if (node->next)
+    node->next->prev = node->prev;
+  else
+    this->tail = node->prev;
+  --this->length;
+}
+
+// Threads a new node onto its value's chain before `successor`, or last if
+// that is null. `found` is the value's bucket, or end() for a new value. The
+// node is freed if the index cannot grow, leaving the list unchanged.
+template <typename T, typename Hash, typename KeyEqual>
+void IndexedLinkedList<T, Hash, KeyEqual>::attach(typename Index::iterator found,
+                                                  IndexedNode<T>* node,
+                                                  IndexedNode<T>* successor) {
+  if (found == this->index.end()) {
+    try {
+      this->index.emplace(&node->data, Bucket{node, node, 1});
+    } catch (...) {
+      delete node;
+      throw;
+    }
+    return;
+  }
+  Bucket& bucket = found->second;
+  IndexedNode<T>* predecessor = successor ? successor->prevEqual : bucket.last;
+  node->prevEqual = predecessor;
+  node->nextEqual = successor;
+  if (predecessor)
+    predecessor->nextEqual = node;
+  else
+    bucket.first = node;
+  if (successor)
+    successor->prevEqual = node;
+  else
+    bucket.last = node;
+  ++bucket.count;
+  if (!predecessor) this->rekey(found);
+}
+
+template <typename T, typename Hash, typename KeyEqual>
+void IndexedLinkedList<T, Hash, KeyEqual>::detach(IndexedNode<T>* node) {
+  auto found = this->index.find(&node->data);
+  Bucket& bucket = found->second;
+  if (--bucket.count == 0) {
+    this->index.erase(found);
+    return;
+  }
+  if (node->prevEqual)
+    node->prevEqual->nextEqual = node->nextEqual;
+  else
+    bucket.first = node->nextEqual;
+  if (node->nextEqual)
+    node->nextEqual->prevEqual = node->prevEqual;
+  else
+    bucket.last = node->prevEqual;
+  if (!node->prevEqual) this->rekey(found);
+}
+
+// Points a bucket's key at its current first node. Reuses the map entry, so
+// nothing is allocated.
+template <typename T, typename Hash, typename KeyEqual>
+void IndexedLinkedList<T, Hash, KeyEqual>::rekey(typename Index::iterator found) {
+  auto entry = this->index.extract(found);
+  entry.key() = &entry.mapped().first->data;
+  this->index.insert(std::move(entry));
+}
+
+template <typename T, typename Hash, typename KeyEqual>
+T IndexedLinkedList<T, Hash, KeyEqual>::release(IndexedNode<T>* node) {
+  this->detach(node);
+  this->unlink(node);
+  T data = std::move(node->data);
+  delete node;
+  return data;
+}
+
+#endif
@@ -0,0 +1,45 @@
+#ifndef INDEXEDLINKEDLISTITERATOR_HPP
+#define INDEXEDLINKEDLISTITERATOR_HPP
+
+#include <stddef.h>
+#include <iterator>
+#include "IndexedNode.hpp"
+
+// Read-only forward iterator: writing through it would bypass the index.
+template <typename T>
+class IndexedLinkedListIterator {
+ public:
+  using iterator_category = std::forward_iterator_tag;
+  using value_type = T;
+  using difference_type = std::ptrdiff_t;
+  using pointer = const T*;
+  using reference = const T&;
+
+  IndexedLinkedListIterator() : current(nullptr) {}
+  IndexedLinkedListIterator(const IndexedNode<T>* start) : current(start) {}
+  IndexedLinkedListIterator<T>& operator++() {
+    this->current = this->current->next;
+    return *this;
+  }
+  IndexedLinkedListIterator<T> operator++(int) {
+    IndexedLinkedListIterator<T> previous = *this;
+    this->current = this->current->next;
+    return previous;
+  }
+  const T& operator*() const {
+    return this->current->data;
+  }
+  const T* operator->() const {
+    return &this->current->data;
+  }
+  const bool operator==(const IndexedLinkedListIterator<T>& other) const {
+    return this->current == other.current;
+  }
+  const bool operator!=(const IndexedLinkedListIterator<T>& other) const {
+    return this->current != other.current;
+  }
+ private:
+  const IndexedNode<T>* current;
+};
+
+#endif
@@ -0,0 +1,34 @@
+#ifndef INDEXEDNODE_HPP
+#define INDEXEDNODE_HPP
+
+#include <ostream>
+#include <utility>
+
+// Node of an IndexedLinkedList. Besides its neighbours in the list it is
+// threaded onto a second chain of the nodes holding an equal value, kept in
+// list order.
+template <typename T>
+struct IndexedNode {
+  T data;
+  IndexedNode* prev;
+  IndexedNode* next;
+  IndexedNode* prevEqual;
+  IndexedNode* nextEqual;
+  IndexedNode(const T&);
+  IndexedNode(T&&);
+
+  friend std::ostream& operator<<(std::ostream& output, const IndexedNode& self) {
+    output << "Data: " << self.data << "Prev: " << self.prev << "Next: " << self.next;
+    return output;
+  }
+};
+
+template <typename T>
+IndexedNode<T>::IndexedNode(const T& data)
+    : data(data), prev(nullptr), next(nullptr), prevEqual(nullptr), nextEqual(nullptr) {}
+
+template <typename T>
+IndexedNode<T>::IndexedNode(T&& data)
+    : data(std::move(data)), prev(nullptr), next(nullptr), prevEqual(nullptr), nextEqual(nullptr) {}
+
+#endif
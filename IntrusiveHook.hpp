@@ -0,0 +1,19 @@
+#ifndef INTRUSIVEHOOK_HPP
+#define INTRUSIVEHOOK_HPP
+
+// Links embedded in an object so that an IntrusiveLinkedList can hold it
+// without allocating a node. A hook starts unlinked, and copying an object
+// does not copy its membership. An object must be removed from its list
+// before it is destroyed.
+struct IntrusiveHook {
+  IntrusiveHook* prev;
+  IntrusiveHook* next;
+
+  IntrusiveHook() : prev(nullptr), next(nullptr) {}
+  IntrusiveHook(const IntrusiveHook&) : prev(nullptr), next(nullptr) {}
+  IntrusiveHook& operator=(const IntrusiveHook&) { return *this; }
+
+  const bool isLinked() const { return this->next != nullptr; }
+};
+
+#endif
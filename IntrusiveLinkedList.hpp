@@ -0,0 +1,333 @@
+#ifndef INTRUSIVELINKEDLIST_HPP
+#define INTRUSIVELINKEDLIST_HPP
+
+#include <stddef.h>
+#include <ostream>
+#include <stdexcept>
+#include "IntrusiveHook.hpp"
+#include "IntrusiveLinkedListIterator.hpp"
+#include "ListIndexOutOfBounds.hpp"
+
+// Doubly linked list threaded through an IntrusiveHook member of the objects
+// themselves, e.g. IntrusiveLinkedList<Job, &Job::hook>. The list never
+// allocates, copies or owns its objects, so it can hold non-copyable types
+// that live in a pool or anywhere else. Appending and removing an object are
+// O(1) and cannot fail for lack of memory. An object can be in one list per
+// hook member at a time. The links form a ring through a sentinel hook in
+// the list, so there are no null checks at the ends.
+template <typename T, IntrusiveHook T::*Hook>
+class IntrusiveLinkedList {
+ public:
+  using value_type = T;
+  using size_type = std::size_t;
+  using reference = T&;
+  using const_reference = const T&;
+  using iterator = IntrusiveLinkedListIterator<T, Hook>;
+  using const_iterator = IntrusiveLinkedListIterator<T, Hook, true>;
+
+  // Constructors
+  IntrusiveLinkedList();
+  IntrusiveLinkedList(const IntrusiveLinkedList&) = delete;
+  IntrusiveLinkedList(IntrusiveLinkedList&&) noexcept;
+  IntrusiveLinkedList& operator=(const IntrusiveLinkedList&) = delete;
+  IntrusiveLinkedList& operator=(IntrusiveLinkedList&&) noexcept;
+  ~IntrusiveLinkedList();
+
+  // Getters
+  T& getHead();
+  const T& getHead() const;
+  T& getTail();
+  const T& getTail() const;
+  const bool isEmpty() const;
+  const std::size_t size() const;
+  static const bool isLinked(const T&);
+
+  // Mutators. Linking an object that is already in a list throws
+  // std::invalid_argument.
+  IntrusiveLinkedList<T, Hook>& append(T&);
+  IntrusiveLinkedList<T, Hook>& prepend(T&);
+  IntrusiveLinkedList<T, Hook>& insert(T&, const std::size_t);
+  T& unappend();
+  T& unprepend();
+  T& remove(const std::size_t);
+  IntrusiveLinkedList<T, Hook>& remove(T&);
+  void clear();
+
+  // Iterators
+  iterator begin();
+  iterator end();
+  const_iterator begin() const;
+  const_iterator end() const;
+  const_iterator cbegin() const;
+  const_iterator cend() const;
+
+  // Operators
+  const T& operator[](const std::size_t) const;
+  T& operator[](const std::size_t);
+
+  // Friend Operator
+  friend std::ostream& operator<<(std::ostream& output, const IntrusiveLinkedList& self) {
+    output << "[";
+    for (const_iterator it = self.begin(); it != self.end(); ++it) {
+      if (it != self.begin()) output << "->";
+      output << *it;
+    }
+    output << "]";
+    return output;
+  }
+
+ private:
+  template <typename U, IntrusiveHook U::*, bool>
+  friend class IntrusiveLinkedListIterator;
+
+  static T& owner(IntrusiveHook*);
+  static IntrusiveHook* hookOf(T&);
+  IntrusiveHook* hookAt(const std::size_t) const;
+  void linkBefore(IntrusiveHook*, IntrusiveHook*);
+  T& unlink(IntrusiveHook*);
+  void adopt(IntrusiveLinkedList&);
+
+  IntrusiveHook sentinel;
+  std::size_t length;
+};
+
+template <typename T, IntrusiveHook T::*Hook>
+IntrusiveLinkedList<T, Hook>::IntrusiveLinkedList() : length(0) {
+  this->sentinel.prev = &this->sentinel;
+  this->sentinel.next = &this->sentinel;
+}
+
+template <typename T, IntrusiveHook T::*Hook>
+IntrusiveLinkedList<T, Hook>::IntrusiveLinkedList(IntrusiveLinkedList&& other) noexcept
+    : IntrusiveLinkedList() {
+  this->adopt(other);
+}
+
+template <typename T, IntrusiveHook T::*Hook>
+IntrusiveLinkedList<T, Hook>& IntrusiveLinkedList<T, Hook>::operator=(
+    IntrusiveLinkedList&& other) noexcept {
+  if (this != &other) {
+    this->clear();
+    this->adopt(other);
+  }
+  return *this;
+}
+
+// Unlinks every object; the objects themselves are left alone.
+template <typename T, IntrusiveHook T::*Hook>
+IntrusiveLinkedList<T, Hook>::~IntrusiveLinkedList() {
+  this->clear();
+}
+
+template <typename T, IntrusiveHook T::*Hook>
+T& IntrusiveLinkedList<T, Hook>::getHead() {
+  if (this->isEmpty()) throw ListIndexOutOfBounds();
+  return owner(this->sentinel.next);
+}
+
+template <typename T, IntrusiveHook T::*Hook>
+const T& IntrusiveLinkedList<T, Hook>::getHead() const {
+  if (this->isEmpty()) throw ListIndexOutOfBounds();
+  return owner(this->sentinel.next);
+}
+
+template <typename T, IntrusiveHook T::*Hook>
+T& IntrusiveLinkedList<T, Hook>::getTail() {
+  if (this->isEmpty()) throw ListIndexOutOfBounds();
+  return owner(this->sentinel.prev);
+}
+
+template <typename T, IntrusiveHook T::*Hook>
+const T& IntrusiveLinkedList<T, Hook>::getTail() const {
+  if (this->isEmpty()) throw ListIndexOutOfBounds();
+  return owner(this->sentinel.prev);
+}
+
+template <typename T, IntrusiveHook T::*Hook>
+const bool IntrusiveLinkedList<T, Hook>::isEmpty() const {
+  return this->sentinel.next == &this->sentinel;
+}
+
+template <typename T, IntrusiveHook T::*Hook>
+const std::size_t IntrusiveLinkedList<T, Hook>::size() const {
+  return this->length;
+}
+
+template <typename T, IntrusiveHook T::*Hook>
+const bool IntrusiveLinkedList<T, Hook>::isLinked(const T& object) {
+  return (object.*Hook).isLinked();
+}
+
+template <typename T, IntrusiveHook T::*Hook>
+IntrusiveLinkedList<T, Hook>& IntrusiveLinkedList<T, Hook>::append(T& object) {
+  this->linkBefore(hookOf(object), &this->sentinel);
+  return *this;
+}
+
+template <typename T, IntrusiveHook T::*Hook>
+IntrusiveLinkedList<T, Hook>& IntrusiveLinkedList<T, Hook>::prepend(T& object) {
+  this->linkBefore(hookOf(object), this->sentinel.next);
+  return *this;
+}
+
+template <typename T, IntrusiveHook T::*Hook>
+IntrusiveLinkedList<T, Hook>& IntrusiveLinkedList<T, Hook>::insert(T& object,
+                                                                   const std::size_t index) {
+  if (index > this->length) throw ListIndexOutOfBounds(index, this->length);
+  this->linkBefore(hookOf(object), this->hookAt(index));
+  return *this;
+}
+
+template <typename T, IntrusiveHook T::*Hook>
+T& IntrusiveLinkedList<T, Hook>::unappend() {
+  if (this->isEmpty()) throw ListIndexOutOfBounds(0, 0);
+  return this->unlink(this->sentinel.prev);
+}
+
+template <typename T, IntrusiveHook T::*Hook>
+T& IntrusiveLinkedList<T, Hook>::unprepend() {
+  if (this->isEmpty()) throw ListIndexOutOfBounds(0, 0);
+  return this->unlink(this->sentinel.next);
+}
+
+template <typename T, IntrusiveHook T::*Hook>
+T& IntrusiveLinkedList<T, Hook>::remove(const std::size_t index) {
+  if (index >= this->length) throw ListIndexOutOfBounds(index, this->length);
+  return this->unlink(this->hookAt(index));
+}
+
+// O(1). The object must be in this list; one that is in no list throws
+// std::invalid_argument.
+template <typename T, IntrusiveHook T::*Hook>
+IntrusiveLinkedList<T, Hook>& IntrusiveLinkedList<T, Hook>::remove(T& object) {
+  IntrusiveHook* hook = hookOf(object);
+  if (!hook->isLinked()) throw std::invalid_argument("object is not in a list");
+  this->unlink(hook);
+  return *this;
+}
+
+template <typename T, IntrusiveHook T::*Hook>
+void IntrusiveLinkedList<T, Hook>::clear() {
+  IntrusiveHook* current = this->sentinel.next;
+  while (current != &this->sentinel) {
+    IntrusiveHook* next = current->next;
+    current->prev = nullptr;
+    current->next = nullptr;
+    current = next;
+  }
+  this->sentinel.prev = &this->sentinel;
+  this->sentinel.next = &this->sentinel;
+  this->length = 0;
+}
+
+template <typename T, IntrusiveHook T::*Hook>
+typename IntrusiveLinkedList<T, Hook>::iterator IntrusiveLinkedList<T, Hook>::begin() {
+  return iterator(this->sentinel.next);
+}
+
+template <typename T, IntrusiveHook T::*Hook>
+typename IntrusiveLinkedList<T, Hook>::iterator IntrusiveLinkedList<T, Hook>::end() {
+  return iterator(&this->sentinel);
+}
+
+template <typename T, IntrusiveHook T::*Hook>
+typename IntrusiveLinkedList<T, Hook>::const_iterator IntrusiveLinkedList<T, Hook>::begin()
+    const {
+  return const_iterator(this->sentinel.next);
+}
+
+template <typename T, IntrusiveHook T::*Hook>
+typename IntrusiveLinkedList<T, Hook>::const_iterator IntrusiveLinkedList<T, Hook>::end() const {
+  return const_iterator(const_cast<IntrusiveHook*>(&this->sentinel));
+}
+
+template <typename T, IntrusiveHook T::*Hook>
+typename IntrusiveLinkedList<T, Hook>::const_iterator IntrusiveLinkedList<T, Hook>::cbegin()
+    const {
+  return this->begin();
+}
+
+template <typename T, IntrusiveHook T::*Hook>
+typename IntrusiveLinkedList<T, Hook>::const_iterator IntrusiveLinkedList<T, Hook>::cend()
+    const {
+  return this->end();
+}
+
+template <typename T, IntrusiveHook T::*Hook>
+const T& IntrusiveLinkedList<T, Hook>::operator[](const std::size_t index) const {
+  if (index >= this->length) throw ListIndexOutOfBounds(index, this->length);
+  return owner(this->hookAt(index));
+}
+
+template <typename T, IntrusiveHook T::*Hook>
+T& IntrusiveLinkedList<T, Hook>::operator[](const std::size_t index) {
+  if (index >= this->length) throw ListIndexOutOfBounds(index, this->length);
+  return owner(this->hookAt(index));
+}
+
+// Recovers the object from its hook. The hook's offset is measured against
+// suitably aligned raw storage that is never read or written, and folds to a
+// constant.
+template <typename T, IntrusiveHook T::*Hook>
+T& IntrusiveLinkedList<T, Hook>::owner(IntrusiveHook* hook) {
+  alignas(T) static unsigned char storage[sizeof(T)];
+  const std::ptrdiff_t offset =
+      reinterpret_cast<unsigned char*>(&(reinterpret_cast<T*>(storage)->*Hook)) - storage;
+  return *reinterpret_cast<T*>(reinterpret_cast<unsigned char*>(hook) - offset);
+}
+
+template <typename T, IntrusiveHook T::*Hook>
+IntrusiveHook* IntrusiveLinkedList<T, Hook>::hookOf(T& object) {
+  return &(object.*Hook);
+}
+
+// Hook at `index`, or the sentinel when it equals the length. Walks from
+// whichever end is closer.
+template <typename T, IntrusiveHook T::*Hook>
+IntrusiveHook* IntrusiveLinkedList<T, Hook>::hookAt(const std::size_t index) const {
+  IntrusiveHook* current = const_cast<IntrusiveHook*>(&this->sentinel);
+  if (index < this->length / 2) {
+    for (std::size_t position = 0; position <= index; ++position) current = current->next;
+  } else {
+    for (std::size_t position = this->length; position > index; --position)
+      current = current->prev;
+  }
+  return current;
+}
+
+template <typename T, IntrusiveHook T::*Hook>
+void IntrusiveLinkedList<T, Hook>::linkBefore(IntrusiveHook* hook, IntrusiveHook* position) {
+  if (hook->isLinked()) throw std::invalid_argument("object is already in a list");
+  hook->prev = position->prev;
+  hook->next = position;
+  position->prev->next = hook;
+  position->prev = hook;
+  ++this->length;
+}
+
+template <typename T, IntrusiveHook T::*Hook>
+T& IntrusiveLinkedList<T, Hook>::unlink(IntrusiveHook* hook) {
+  hook->prev->next = hook->next;
+  hook->next->prev = hook->prev;
+  hook->prev = nullptr;
+  hook->next = nullptr;
+  --this->length;
+  return owner(hook);
+}
+
+// Takes over the objects of `other`, repointing the first and last at this
+// sentinel. This list must be empty.
+template <typename T, IntrusiveHook T::*Hook>
+void IntrusiveLinkedList<T, Hook>::adopt(IntrusiveLinkedList& other) {
+  if (other.isEmpty()) return;
+  this->sentinel.next = other.sentinel.next;
+  this->sentinel.prev = other.sentinel.prev;
+  this->sentinel.next->prev = &this->sentinel;
+  this->sentinel.prev->next = &this->sentinel;
+  this->length = other.length;
+  other.sentinel.prev = &other.sentinel;
+  other.sentinel.next = &other.sentinel;
+  other.length = 0;
+}
+
+#endif
@@ -0,0 +1,72 @@
+#ifndef INTRUSIVELINKEDLISTITERATOR_HPP
+#define INTRUSIVELINKEDLISTITERATOR_HPP
+
+#include <stddef.h>
+#include <iterator>
+#include <type_traits>
+#include "IntrusiveHook.hpp"
+
+template <typename T, IntrusiveHook T::*Hook>
+class IntrusiveLinkedList;
+
+// Bidirectional iterator over the objects of an IntrusiveLinkedList. The
+// past-the-end position is the list's sentinel hook.
+template <typename T, IntrusiveHook T::*Hook, bool Const = false>
+class IntrusiveLinkedListIterator {
+ public:
+  using iterator_category = std::bidirectional_iterator_tag;
+  using value_type = T;
+  using difference_type = std::ptrdiff_t;
+  using pointer = typename std::conditional<Const, const T*, T*>::type;
+  using reference = typename std::conditional<Const, const T&, T&>::type;
+
+  IntrusiveLinkedListIterator() : current(nullptr) {}
+  template <bool OtherConst, typename = typename std::enable_if<Const && !OtherConst>::type>
+  IntrusiveLinkedListIterator(const IntrusiveLinkedListIterator<T, Hook, OtherConst>& other)
+      : current(other.current) {}
+
+  IntrusiveLinkedListIterator& operator++() {
+    this->current = this->current->next;
+    return *this;
+  }
+  IntrusiveLinkedListIterator operator++(int) {
+    IntrusiveLinkedListIterator previous = *this;
+    this->current = this->current->next;
+    return previous;
+  }
+  IntrusiveLinkedListIterator& operator--() {
+    this->current = this->current->prev;
+    return *this;
+  }
+  IntrusiveLinkedListIterator operator--(int) {
+    IntrusiveLinkedListIterator previous = *this;
+    this->current = this->current->prev;
+    return previous;
+  }
+  reference operator*() const {
+    return IntrusiveLinkedList<T, Hook>::owner(this->current);
+  }
+  pointer operator->() const {
+    return &IntrusiveLinkedList<T, Hook>::owner(this->current);
+  }
+  template <bool OtherConst>
+  const bool operator==(const IntrusiveLinkedListIterator<T, Hook, OtherConst>& other) const {
+    return this->current == other.current;
+  }
+  template <bool OtherConst>
+  const bool operator!=(const IntrusiveLinkedListIterator<T, Hook, OtherConst>& other) const {
+    return this->current != other.current;
+  }
+
+ private:
+  template <typename U, IntrusiveHook U::*>
+  friend class IntrusiveLinkedList;
+  template <typename U, IntrusiveHook U::*, bool>
+  friend class IntrusiveLinkedListIterator;
+
+  explicit IntrusiveLinkedListIterator(IntrusiveHook* start) : current(start) {}
+
+  IntrusiveHook* current;
+};
+
+#endif
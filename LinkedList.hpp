@@ -2,18 +2,54 @@
 #define LINKEDLIST_HPP
 
 #include <stddef.h>
+#include <algorithm>
+#include <functional>
 #include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
 #include "LinkedListIterator.hpp"
+#include "ListFile.hpp"
 #include "ListIndexOutOfBounds.hpp"
+#include "ListStatistics.hpp"
 #include "Node.hpp"
+#include "ThreadPool.hpp"
 
-template <typename T>
-class LinkedList {
+// Statistics is a policy from ListStatistics.hpp told about node allocations
+// and positional walks. It is a private base so that the empty default takes
+// no space in the list.
+template <typename T, typename Allocator = std::allocator<T>,
+          typename Statistics = NoListStatistics>
+class LinkedList : private Statistics {
  public:
+  using value_type = T;
+  using allocator_type = Allocator;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using reference = T&;
+  using const_reference = const T&;
+  using iterator = LinkedListIterator<T>;
+  using const_iterator = LinkedListIterator<T, true>;
+  // Restricts the range members to iterator types.
+  template <typename InputIt>
+  using IteratorCategory = typename std::iterator_traits<InputIt>::iterator_category;
+
   // Constructors
   LinkedList();
-  LinkedList(const T&);
-  LinkedList(const std::initializer_list<T>);
+  explicit LinkedList(const Allocator&);
+  LinkedList(const T&, const Allocator& = Allocator());
+  LinkedList(const std::initializer_list<T>, const Allocator& = Allocator());
+  template <typename InputIt, typename = IteratorCategory<InputIt>>
+  LinkedList(InputIt, InputIt, const Allocator& = Allocator());
+  LinkedList(const LinkedList&);
+  LinkedList(LinkedList&&) noexcept;
+  LinkedList& operator=(const LinkedList&);
+  LinkedList& operator=(LinkedList&&);
+  ~LinkedList();
 
   // Getters
   const T& getHead() const;
@@ -21,19 +57,85 @@ class LinkedList {
   const bool isEmpty() const;
   const bool contains(const T&) const;
   const std::size_t size() const;
+  Allocator getAllocator() const;
+  const Statistics& getStatistics() const;
+  Statistics& getStatistics();
 
   // Mutators
-  LinkedList<T>& append(const T&);
-  LinkedList<T>& prepend(const T&);
-  LinkedList<T>& insert(const T&, const std::size_t);
+  LinkedList<T, Allocator, Statistics>& append(const T&);
+  LinkedList<T, Allocator, Statistics>& append(T&&);
+  LinkedList<T, Allocator, Statistics>& prepend(const T&);
+  LinkedList<T, Allocator, Statistics>& prepend(T&&);
+  LinkedList<T, Allocator, Statistics>& insert(const T&, const std::size_t);
+  LinkedList<T, Allocator, Statistics>& insert(T&&, const std::size_t);
+  template <typename InputIt, typename = IteratorCategory<InputIt>>
+  LinkedList<T, Allocator, Statistics>& appendRange(InputIt, InputIt);
+  template <typename InputIt, typename = IteratorCategory<InputIt>>
+  LinkedList<T, Allocator, Statistics>& prependRange(InputIt, InputIt);
+  template <typename InputIt, typename = IteratorCategory<InputIt>>
+  LinkedList<T, Allocator, Statistics>& insertRange(const std::size_t, InputIt, InputIt);
+  template <typename... Args>
+  LinkedList<T, Allocator, Statistics>& emplaceBack(Args&&...);
+  template <typename... Args>
+  LinkedList<T, Allocator, Statistics>& emplaceFront(Args&&...);
+  template <typename... Args>
+  LinkedList<T, Allocator, Statistics>& emplace(const std::size_t, Args&&...);
   T unappend();
   T unprepend();
   T remove(const std::size_t);
-  LinkedList<T>& remove(const T&, const std::size_t);
+  LinkedList<T, Allocator, Statistics>& remove(const T&, const std::size_t);
+  void clear();
+
+  // Relinking
+  LinkedList<T, Allocator, Statistics>& splice(LinkedList&&);
+  LinkedList<T, Allocator, Statistics>& splice(const std::size_t, LinkedList&&);
+  LinkedList<T, Allocator, Statistics>& splice(LinkedList&, const_iterator, const_iterator);
+  LinkedList<T, Allocator, Statistics> splitAt(const std::size_t);
+
+  // Files
+  void save(const std::string&) const;
+  LinkedList<T, Allocator, Statistics>& load(const std::string&);
+
+  // Traversal
+  LinkedList<T, Allocator, Statistics>& setPrefetching(const bool);
+  const bool isPrefetching() const;
+  template <typename Function>
+  LinkedList<T, Allocator, Statistics>& forEach(Function);
+  template <typename Function>
+  const LinkedList<T, Allocator, Statistics>& forEach(Function) const;
+
+  // Layout
+  LinkedList<T, Allocator, Statistics>& relayout();
+  const bool relayout(const std::size_t);
+
+  // Parallel traversal
+  template <typename Function>
+  LinkedList<T, Allocator, Statistics>& parallelForEach(Function,
+                                                        ThreadPool& = ThreadPool::shared());
+  template <typename Function>
+  using TransformResult =
+      typename std::decay<decltype(std::declval<Function&>()(std::declval<const T&>()))>::type;
+  template <typename Function>
+  LinkedList<TransformResult<Function>> parallelTransform(
+      Function, ThreadPool& = ThreadPool::shared()) const;
+  template <typename BinaryOperation>
+  T parallelReduce(T, BinaryOperation, ThreadPool& = ThreadPool::shared()) const;
+
+  // Ordering
+  template <typename Compare = std::less<T>>
+  LinkedList<T, Allocator, Statistics>& sort(Compare = Compare());
+  template <typename Compare = std::less<T>>
+  LinkedList<T, Allocator, Statistics>& merge(LinkedList&&, Compare = Compare());
+  template <typename BinaryPredicate = std::equal_to<T>>
+  LinkedList<T, Allocator, Statistics>& unique(BinaryPredicate = BinaryPredicate());
 
   // Iterators
-  LinkedListIterator<T> begin() const;
-  const Node<T>* end() const;
+  iterator begin();
+  iterator end();
+  const_iterator begin() const;
+  const_iterator end() const;
+  const_iterator cbegin() const;
+  const_iterator cend() const;
 
   // Operators
   const bool operator==(const LinkedList&) const;
@@ -44,191 +146,488 @@ class LinkedList {
   // Friend Operator
   friend std::ostream& operator<<(std::ostream& output,
                                   const LinkedList& self) {
-    Node<T>* current = self.head;
+    Traversal walk(self);
     output << "[";
-    if (current) {
-      while (current->next) {
-        output << current->data << "->";
-        current = current->next;
-      }
+    if (Node<T>* current = walk.next()) {
       output << current->data;
+      while ((current = walk.next())) output << "->" << current->data;
     }
     output << "]";
     return output;
   }
 
  private:
+  using NodeAllocator =
+      typename std::allocator_traits<Allocator>::template rebind_alloc<Node<T>>;
+  using NodeTraits = std::allocator_traits<NodeAllocator>;
+
+  // Null-terminated run of nodes, used while sorting and merging.
+  struct Chain {
+    Node<T>* first;
+    Node<T>* last;
+  };
+
+  // Jump pointers of a prefetching list: every jumpStride-th node after head,
+  // in list order, and the length of the list when they were taken.
+  struct JumpTable {
+    std::vector<Node<T>*> jumps;
+    std::size_t builtLength;
+  };
+  class Traversal;
+
+  // One allocation of `count` nodes made by relayout, freed once none of the
+  // `live` nodes constructed in it is left. Lists that nodes of a block are
+  // handed over to share it.
+  struct NodeBlock {
+    Node<T>* first;
+    std::size_t count;
+    std::size_t live;
+  };
+  // The blocks a relaid-out list may hold nodes of, and the relayout pass in
+  // progress: the block being filled, how many of its nodes are used, and the
+  // last node placed in it, null until the first.
+  struct Layout {
+    std::vector<std::shared_ptr<NodeBlock>> blocks;
+    std::shared_ptr<NodeBlock> filling;
+    std::size_t placed;
+    Node<T>* previous;
+  };
+
+  static const std::size_t jumpStride = 64;
+  static const std::size_t warmedSegments = 16;
+
+  template <typename Compare>
+  static Chain mergeChains(Chain, Chain, Compare&);
+  std::vector<Node<T>*> segments(const ThreadPool&) const;
+  Node<T>* nodeAt(const std::size_t, const ListWalk) const;
+  void linkChain(const std::size_t, Node<T>*, Node<T>*, const std::size_t, const ListWalk);
+  template <typename InputIt>
+  Chain createChain(InputIt, InputIt, std::size_t&);
+  template <typename Pool, typename InputIt>
+  static auto reserveNodes(Pool&, InputIt, InputIt, int)
+      -> decltype(std::declval<Pool&>().reserve(0), void());
+  template <typename Pool, typename InputIt>
+  static void reserveNodes(Pool&, InputIt, InputIt, long);
+  void resetCursor() const;
+  template <typename... Args>
+  Node<T>* createNode(Args&&...);
+  void destroyNode(Node<T>*);
+  void handOver(LinkedList&, const std::size_t);
+  const std::vector<Node<T>*>* currentJumps() const;
+  void dropJumps();
+  const bool releaseNode(Node<T>*);
+  void endRelayout();
+  void pruneBlocks();
+
   Node<T>* head;
   Node<T>* tail;
   std::size_t length;
+  NodeAllocator allocator;
+  // Last position reached by nodeAt. Lets ascending indexed loops resume
+  // where the previous access stopped instead of restarting from head. It is
+  // updated even by const accessors, so concurrent readers need external
+  // synchronization.
+  mutable Node<T>* cursorNode;
+  mutable std::size_t cursorIndex;
+  // Set while prefetching. Rebuilt by const traversals as the list grows, so
+  // like the cursor it needs external synchronization between readers.
+  std::unique_ptr<JumpTable> jumpTable;
+  // Set once relayout has run or relaid-out nodes were handed over.
+  std::unique_ptr<Layout> layout;
 };
 
-template <typename T>
-LinkedList<T>::LinkedList() : head(nullptr), tail(nullptr), length(0) {}
+// Hands out the nodes of a list in order. For a prefetching list with jump
+// pointers it first walks the next warmedSegments segments side by side, so
+// that their cache misses overlap instead of waiting on one another, and then
+// hands out the nodes of those segments from the cache.
+template <typename T, typename Allocator, typename Statistics>
+class LinkedList<T, Allocator, Statistics>::Traversal {
+ public:
+  explicit Traversal(const LinkedList&);
 
-template <typename T>
-LinkedList<T>::LinkedList(const T& data)
-    : head(new Node<T>(data)), tail(this->head), length(1) {}
+  // The next node, or null past the tail.
+  Node<T>* next();
 
-template <typename T>
-LinkedList<T>::LinkedList(const std::initializer_list<T> args)
-    : head(nullptr), tail(nullptr), length(0) {
-  for (auto it = std::rbegin(args); it != std::rend(args); ++it) {
-    this->prepend(*it);
-    ++this->length;
+ private:
+  Node<T>* start(const std::size_t) const;
+  void warm();
+
+  Node<T>* head;
+  const std::vector<Node<T>*>* jumps;
+  Node<T>* upcoming;
+  // Segments warmed so far, and the first node of the next one to warm.
+  std::size_t warmed;
+  Node<T>* boundary;
+};
+
+template <typename T, typename Allocator, typename Statistics>
+LinkedList<T, Allocator, Statistics>::LinkedList()
+    : head(nullptr),
+      tail(nullptr),
+      length(0),
+      allocator(),
+      cursorNode(nullptr),
+      cursorIndex(0) {}
+
+template <typename T, typename Allocator, typename Statistics>
+LinkedList<T, Allocator, Statistics>::LinkedList(const Allocator& allocator)
+    : head(nullptr),
+      tail(nullptr),
+      length(0),
+      allocator(allocator),
+      cursorNode(nullptr),
+      cursorIndex(0) {}
+
+template <typename T, typename Allocator, typename Statistics>
+LinkedList<T, Allocator, Statistics>::LinkedList(const T& data, const Allocator& allocator)
+    : head(nullptr),
+      tail(nullptr),
+      length(0),
+      allocator(allocator),
+      cursorNode(nullptr),
+      cursorIndex(0) {
+  this->append(data);
+}
+
+template <typename T, typename Allocator, typename Statistics>
+LinkedList<T, Allocator, Statistics>::LinkedList(const std::initializer_list<T> args,
+                                                 const Allocator& allocator)
+    : head(nullptr),
+      tail(nullptr),
+      length(0),
+      allocator(allocator),
+      cursorNode(nullptr),
+      cursorIndex(0) {
+  this->appendRange(args.begin(), args.end());
+}
+
+template <typename T, typename Allocator, typename Statistics>
+template <typename InputIt, typename>
+LinkedList<T, Allocator, Statistics>::LinkedList(InputIt first, InputIt last,
+                                                 const Allocator& allocator)
+    : head(nullptr),
+      tail(nullptr),
+      length(0),
+      allocator(allocator),
+      cursorNode(nullptr),
+      cursorIndex(0) {
+  this->appendRange(first, last);
+}
+
+template <typename T, typename Allocator, typename Statistics>
+LinkedList<T, Allocator, Statistics>::LinkedList(const LinkedList& other)
+    : head(nullptr),
+      tail(nullptr),
+      length(0),
+      allocator(NodeTraits::select_on_container_copy_construction(other.allocator)),
+      cursorNode(nullptr),
+      cursorIndex(0),
+      jumpTable(other.jumpTable ? new JumpTable() : nullptr) {
+  this->appendRange(other.begin(), other.end());
+}
+
+template <typename T, typename Allocator, typename Statistics>
+LinkedList<T, Allocator, Statistics>::LinkedList(LinkedList&& other) noexcept
+    : head(other.head),
+      tail(other.tail),
+      length(other.length),
+      allocator(std::move(other.allocator)),
+      cursorNode(nullptr),
+      cursorIndex(0),
+      jumpTable(std::move(other.jumpTable)),
+      layout(std::move(other.layout)) {
+  // The layout goes along with every node, a relayout pass in progress
+  // included, so handOver has no blocks left to share and cannot throw.
+  other.handOver(*this, other.length);
+  other.head = nullptr;
+  other.tail = nullptr;
+  other.length = 0;
+  other.resetCursor();
+}
+
+template <typename T, typename Allocator, typename Statistics>
+LinkedList<T, Allocator, Statistics>& LinkedList<T, Allocator, Statistics>::operator=(
+    const LinkedList& other) {
+  if (this != &other) {
+    this->clear();
+    if (NodeTraits::propagate_on_container_copy_assignment::value)
+      this->allocator = other.allocator;
+    this->appendRange(other.begin(), other.end());
+  }
+  return *this;
+}
+
+// Steals the chain when the allocators can free each other's nodes, and
+// otherwise falls back to moving element by element.
+template <typename T, typename Allocator, typename Statistics>
+LinkedList<T, Allocator, Statistics>& LinkedList<T, Allocator, Statistics>::operator=(
+    LinkedList&& other) {
+  if (this == &other) return *this;
+  this->clear();
+  if (NodeTraits::propagate_on_container_move_assignment::value ||
+      this->allocator == other.allocator) {
+    if (NodeTraits::propagate_on_container_move_assignment::value)
+      this->allocator = std::move(other.allocator);
+    other.handOver(*this, other.length);
+    other.dropJumps();
+    this->head = other.head;
+    this->tail = other.tail;
+    this->length = other.length;
+    other.head = nullptr;
+    other.tail = nullptr;
+    other.length = 0;
+    other.resetCursor();
+  } else {
+    for (Node<T>* current = other.head; current; current = current->next)
+      this->append(std::move(current->data));
+    other.clear();
   }
+  return *this;
 }
 
-template <typename T>
-const bool LinkedList<T>::isEmpty() const {
+template <typename T, typename Allocator, typename Statistics>
+LinkedList<T, Allocator, Statistics>::~LinkedList() {
+  this->clear();
+}
+
+template <typename T, typename Allocator, typename Statistics>
+const bool LinkedList<T, Allocator, Statistics>::isEmpty() const {
   return this->head == nullptr && this->tail == nullptr;
 }
 
-template <typename T>
-const bool LinkedList<T>::contains(const T& data) const {
-  return this->head == nullptr;
+template <typename T, typename Allocator, typename Statistics>
+const bool LinkedList<T, Allocator, Statistics>::contains(const T& data) const {
+  Traversal walk(*this);
+  while (Node<T>* current = walk.next())
+    if (current->data == data) return true;
+  return false;
 }
 
-template <typename T>
-const T& LinkedList<T>::getHead() const {
+template <typename T, typename Allocator, typename Statistics>
+const T& LinkedList<T, Allocator, Statistics>::getHead() const {
   if (this->isEmpty()) throw ListIndexOutOfBounds();
   return this->head->data;
 }
 
-template <typename T>
-const T& LinkedList<T>::getTail() const {
+template <typename T, typename Allocator, typename Statistics>
+const T& LinkedList<T, Allocator, Statistics>::getTail() const {
   if (this->isEmpty()) throw ListIndexOutOfBounds();
   return this->tail->data;
 }
 
-template <typename T>
-const std::size_t LinkedList<T>::size() const {
+template <typename T, typename Allocator, typename Statistics>
+const std::size_t LinkedList<T, Allocator, Statistics>::size() const {
   return this->length;
 }
 
-template <typename T>
-LinkedList<T>& LinkedList<T>::append(const T& data) {
+template <typename T, typename Allocator, typename Statistics>
+Allocator LinkedList<T, Allocator, Statistics>::getAllocator() const {
+  return Allocator(this->allocator);
+}
+
+template <typename T, typename Allocator, typename Statistics>
+const Statistics& LinkedList<T, Allocator, Statistics>::getStatistics() const {
+  return *this;
+}
+
+template <typename T, typename Allocator, typename Statistics>
+Statistics& LinkedList<T, Allocator, Statistics>::getStatistics() {
+  return *this;
+}
+
+template <typename T, typename Allocator, typename Statistics>
+LinkedList<T, Allocator, Statistics>& LinkedList<T, Allocator, Statistics>::append(const T& data) {
+  return this->emplaceBack(data);
+}
+
+template <typename T, typename Allocator, typename Statistics>
+LinkedList<T, Allocator, Statistics>& LinkedList<T, Allocator, Statistics>::append(T&& data) {
+  return this->emplaceBack(std::move(data));
+}
+
+template <typename T, typename Allocator, typename Statistics>
+LinkedList<T, Allocator, Statistics>& LinkedList<T, Allocator, Statistics>::prepend(const T& data) {
+  return this->emplaceFront(data);
+}
+
+template <typename T, typename Allocator, typename Statistics>
+LinkedList<T, Allocator, Statistics>& LinkedList<T, Allocator, Statistics>::prepend(T&& data) {
+  return this->emplaceFront(std::move(data));
+}
+
+template <typename T, typename Allocator, typename Statistics>
+LinkedList<T, Allocator, Statistics>& LinkedList<T, Allocator, Statistics>::insert(
+    const T& data, const std::size_t index) {
+  return this->emplace(index, data);
+}
+
+template <typename T, typename Allocator, typename Statistics>
+LinkedList<T, Allocator, Statistics>& LinkedList<T, Allocator, Statistics>::insert(
+    T&& data, const std::size_t index) {
+  return this->emplace(index, std::move(data));
+}
+
+// The range members create every node before linking any, so the list is
+// unchanged if an element fails to copy, then link them in one step. For a
+// forward range they first ask the allocator to reserve all the nodes, which
+// SlabAllocator serves from one contiguous slab.
+template <typename T, typename Allocator, typename Statistics>
+template <typename InputIt, typename>
+LinkedList<T, Allocator, Statistics>& LinkedList<T, Allocator, Statistics>::appendRange(
+    InputIt first, InputIt last) {
+  return this->insertRange(this->length, first, last);
+}
+
+template <typename T, typename Allocator, typename Statistics>
+template <typename InputIt, typename>
+LinkedList<T, Allocator, Statistics>& LinkedList<T, Allocator, Statistics>::prependRange(
+    InputIt first, InputIt last) {
+  return this->insertRange(0, first, last);
+}
+
+template <typename T, typename Allocator, typename Statistics>
+template <typename InputIt, typename>
+LinkedList<T, Allocator, Statistics>& LinkedList<T, Allocator, Statistics>::insertRange(
+    const std::size_t index, InputIt first, InputIt last) {
+  if (index > this->length) throw ListIndexOutOfBounds(index, this->length);
+  std::size_t count = 0;
+  const Chain chain = this->createChain(first, last, count);
+  if (count) this->linkChain(index, chain.first, chain.last, count, ListWalk::Insert);
+  return *this;
+}
+
+template <typename T, typename Allocator, typename Statistics>
+template <typename... Args>
+LinkedList<T, Allocator, Statistics>& LinkedList<T, Allocator, Statistics>::emplaceBack(
+    Args&&... args) {
+  Node<T>* back = this->createNode(std::forward<Args>(args)...);
   if (this->isEmpty()) {
-    this->head = new Node<T>(data);
+    this->head = back;
     this->tail = this->head;
   } else {
-    this->tail->next = new Node<T>(data);
+    this->tail->next = back;
     this->tail = this->tail->next;
   }
   ++this->length;
   return *this;
 }
 
-template <typename T>
-LinkedList<T>& LinkedList<T>::prepend(const T& data) {
-  Node<T>* front = new Node<T>(data);
+template <typename T, typename Allocator, typename Statistics>
+template <typename... Args>
+LinkedList<T, Allocator, Statistics>& LinkedList<T, Allocator, Statistics>::emplaceFront(
+    Args&&... args) {
+  Node<T>* front = this->createNode(std::forward<Args>(args)...);
   front->next = this->head;
   if (this->isEmpty()) this->tail = front;
   this->head = front;
   ++this->length;
+  if (this->cursorNode) ++this->cursorIndex;
   return *this;
 }
 
-template <typename T>
-LinkedList<T>& LinkedList<T>::insert(const T& data, const std::size_t index) {
+template <typename T, typename Allocator, typename Statistics>
+template <typename... Args>
+LinkedList<T, Allocator, Statistics>& LinkedList<T, Allocator, Statistics>::emplace(
+    const std::size_t index, Args&&... args) {
   if (index > this->length) throw ListIndexOutOfBounds(index, this->length);
   if (index == 0)
-    return this->prepend(data);
+    return this->emplaceFront(std::forward<Args>(args)...);
   else if (index == this->length)
-    return this->append(data);
+    return this->emplaceBack(std::forward<Args>(args)...);
   else {
-    std::size_t position = 0;
-    Node<T>* prior = this->head;
-    while (position < index - 1) {
-      ++position;
-      prior = prior->next;
-    }
-    Node<T>* toAdd = new Node<T>(data);
+    Node<T>* prior = this->nodeAt(index - 1, ListWalk::Insert);
+    Node<T>* toAdd = this->createNode(std::forward<Args>(args)...);
     toAdd->next = prior->next;
     prior->next = toAdd;
     ++this->length;
+    this->cursorNode = toAdd;
+    this->cursorIndex = index;
   }
   return *this;
 }
 
-template <typename T>
-T LinkedList<T>::unappend() {
+template <typename T, typename Allocator, typename Statistics>
+T LinkedList<T, Allocator, Statistics>::unappend() {
   if (this->isEmpty())
     throw ListIndexOutOfBounds(0, 0);
   else if (this->length == 1) {
-    T data = this->head->data;
-    delete this->head;
+    T data = std::move(this->head->data);
+    this->destroyNode(this->head);
     this->head = nullptr;
     this->tail = nullptr;
     --this->length;
+    this->resetCursor();
     return data;
   } else {
-    Node<T>* current = this->head;
-    while (current->next->next) current = current->next;
-    T data = this->tail->data;
-    delete this->tail;
+    Node<T>* current = this->nodeAt(this->length - 2, ListWalk::Unappend);
+    T data = std::move(this->tail->data);
+    this->destroyNode(this->tail);
+    current->next = nullptr;
     this->tail = current;
     --this->length;
     return data;
   }
 }
 
-template <typename T>
-T LinkedList<T>::unprepend() {
+template <typename T, typename Allocator, typename Statistics>
+T LinkedList<T, Allocator, Statistics>::unprepend() {
   if (this->isEmpty())
     throw ListIndexOutOfBounds(0, 0);
   else if (this->length == 1) {
-    T data = this->head->data;
-    delete this->tail;
+    T data = std::move(this->head->data);
+    this->destroyNode(this->tail);
     this->head = nullptr;
     this->tail = nullptr;
     --this->length;
+    this->resetCursor();
     return data;
   } else {
     Node<T>* front = this->head->next;
     this->head->next = nullptr;
-    T data = this->head->data;
-    delete this->head;
+    if (this->cursorNode == this->head)
+      this->resetCursor();
+    else if (this->cursorNode)
+      --this->cursorIndex;
+    T data = std::move(this->head->data);
+    this->destroyNode(this->head);
     this->head = front;
     --this->length;
     return data;
   }
 }
 
-template <typename T>
-T LinkedList<T>::remove(const std::size_t index) {
-  if (index > this->length)
+template <typename T, typename Allocator, typename Statistics>
+T LinkedList<T, Allocator, Statistics>::remove(const std::size_t index) {
+  if (index >= this->length)
     throw ListIndexOutOfBounds(index, this->length);
   else if (index == 0)
     return this->unprepend();
-  else if (index == this->length)
+  else if (index == this->length - 1)
     return this->unappend();
   else {
-    std::size_t position = 0;
-    Node<T>* prior = this->head;
-    while (position < index - 1) {
-      ++position;
-      prior = prior->next;
-    }
+    Node<T>* prior = this->nodeAt(index - 1, ListWalk::Remove);
     Node<T>* out = prior->next;
     prior->next = prior->next->next;
     out->next = nullptr;
-    T data = out->data;
-    delete out;
+    T data = std::move(out->data);
+    this->destroyNode(out);
+    --this->length;
     return data;
   }
 }
 
-template <typename T>
-LinkedList<T>& LinkedList<T>::remove(const T& data, const std::size_t num) {
+template <typename T, typename Allocator, typename Statistics>
+LinkedList<T, Allocator, Statistics>& LinkedList<T, Allocator, Statistics>::remove(
+    const T& data, const std::size_t num) {
   Node<T>* current = this->head;
   std::size_t numRemoved = 0;
   while (numRemoved < num && current && current->data == data) {
     this->head = current->next;
-    delete current;
+    this->destroyNode(current);
     current = this->head;
     ++numRemoved;
   }
+  if (!current) this->tail = nullptr;
   if (current) {
     Node<T>* previous = current;
     current = current->next;
@@ -236,7 +635,7 @@ LinkedList<T>& LinkedList<T>::remove(const T& data, const std::size_t num) {
       if (current->data == data) {
         previous->next = current->next;
         if (this->tail == current) this->tail = previous;
-        delete current;
+        this->destroyNode(current);
         current = previous->next;
         ++numRemoved;
       } else {
@@ -245,71 +644,761 @@ LinkedList<T>& LinkedList<T>::remove(const T& data, const std::size_t num) {
       }
   }
   this->length -= numRemoved;
+  if (numRemoved) this->resetCursor();
+  return *this;
+}
+
+template <typename T, typename Allocator, typename Statistics>
+void LinkedList<T, Allocator, Statistics>::clear() {
+  while (this->head) {
+    Node<T>* next = this->head->next;
+    this->destroyNode(this->head);
+    this->head = next;
+  }
+  this->tail = nullptr;
+  this->length = 0;
+  this->resetCursor();
+  if (this->layout) this->endRelayout();
+}
+
+// Moves every node of `other` onto the end of this list. O(1) unless the
+// allocators differ, in which case the elements are moved one by one.
+template <typename T, typename Allocator, typename Statistics>
+LinkedList<T, Allocator, Statistics>& LinkedList<T, Allocator, Statistics>::splice(
+    LinkedList&& other) {
+  return this->splice(this->length, std::move(other));
+}
+
+// Moves every node of `other` in front of position `index`. O(1) at either
+// end of this list, otherwise a walk to the insertion point.
+template <typename T, typename Allocator, typename Statistics>
+LinkedList<T, Allocator, Statistics>& LinkedList<T, Allocator, Statistics>::splice(
+    const std::size_t index, LinkedList&& other) {
+  if (index > this->length) throw ListIndexOutOfBounds(index, this->length);
+  if (this == &other || other.isEmpty()) return *this;
+  if (this->allocator != other.allocator) {
+    LinkedList<T, Allocator, Statistics> moved(this->getAllocator());
+    for (Node<T>* current = other.head; current; current = current->next)
+      moved.append(std::move(current->data));
+    other.clear();
+    return this->splice(index, std::move(moved));
+  }
+  this->linkChain(index, other.head, other.tail, other.length, ListWalk::Splice);
+  other.handOver(*this, other.length);
+  other.dropJumps();
+  other.head = nullptr;
+  other.tail = nullptr;
+  other.length = 0;
+  other.resetCursor();
+  return *this;
+}
+
+// Moves the nodes [first, last) of another list onto the end of this one.
+// Finding the node before `first` and counting the range walks `other`.
+template <typename T, typename Allocator, typename Statistics>
+LinkedList<T, Allocator, Statistics>& LinkedList<T, Allocator, Statistics>::splice(
+    LinkedList& other, const_iterator first, const_iterator last) {
+  if (this == &other || first.current == last.current) return *this;
+  Node<T>* before = nullptr;
+  if (first.current != other.head) {
+    before = other.head;
+    while (before->next != first.current) before = before->next;
+  }
+  Node<T>* back = first.current;
+  std::size_t count = 1;
+  while (back->next != last.current) {
+    back = back->next;
+    ++count;
+  }
+  if (before)
+    before->next = last.current;
+  else
+    other.head = last.current;
+  if (other.tail == back) other.tail = before;
+  other.length -= count;
+  other.resetCursor();
+  other.dropJumps();
+  back->next = nullptr;
+  if (this->allocator != other.allocator) {
+    Node<T>* current = first.current;
+    while (current) {
+      Node<T>* next = current->next;
+      this->append(std::move(current->data));
+      other.destroyNode(current);
+      current = next;
+    }
+  } else {
+    this->linkChain(this->length, first.current, back, count, ListWalk::Splice);
+    other.handOver(*this, count);
+  }
+  return *this;
+}
+
+// Cuts the list before position `index`, keeping [0, index) and returning
+// the rest as a new list with the allocator a copy of this list would get.
+// The nodes are relinked when that allocator can free them, and otherwise
+// their elements are moved one by one.
+template <typename T, typename Allocator, typename Statistics>
+LinkedList<T, Allocator, Statistics> LinkedList<T, Allocator, Statistics>::splitAt(
+    const std::size_t index) {
+  if (index > this->length) throw ListIndexOutOfBounds(index, this->length);
+  LinkedList<T, Allocator, Statistics> rest(
+      Allocator(NodeTraits::select_on_container_copy_construction(this->allocator)));
+  if (index == this->length) return rest;
+  if (rest.allocator != this->allocator) {
+    rest.splice(*this, const_iterator(this->nodeAt(index, ListWalk::Split)), this->cend());
+    return rest;
+  }
+  Node<T>* prior = index ? this->nodeAt(index - 1, ListWalk::Split) : nullptr;
+  rest.head = prior ? prior->next : this->head;
+  rest.tail = this->tail;
+  rest.length = this->length - index;
+  this->handOver(rest, rest.length);
+  this->dropJumps();
+  if (prior) {
+    prior->next = nullptr;
+    this->tail = prior;
+  } else {
+    this->head = nullptr;
+    this->tail = nullptr;
+    this->resetCursor();
+  }
+  this->length = index;
+  return rest;
+}
+
+// Writes the list in the ListFile format, replacing `path` only once the
+// whole list is on disk.
+template <typename T, typename Allocator, typename Statistics>
+void LinkedList<T, Allocator, Statistics>::save(const std::string& path) const {
+  ListFileWriter<T> writer(path, this->length);
+  for (Node<T>* current = this->head; current; current = current->next)
+    writer.write(current->data);
+  writer.finish();
+}
+
+// Replaces the contents with a list read from `path`. Leaves the list
+// unchanged if the file cannot be read.
+template <typename T, typename Allocator, typename Statistics>
+LinkedList<T, Allocator, Statistics>& LinkedList<T, Allocator, Statistics>::load(
+    const std::string& path) {
+  ListFileReader<T> reader(path);
+  LinkedList<T, Allocator, Statistics> loaded(this->getAllocator());
+  for (std::size_t i = 0; i < reader.size(); ++i) loaded.emplaceBack(reader.next());
+  return *this = std::move(loaded);
+}
+
+// Prefetching speeds up the full traversals of long lists whose nodes are
+// scattered in memory: contains, operator==, operator<< and forEach. The list
+// keeps a pointer to every 64th node, taken by the first such traversal and
+// dropped when nodes are removed or relinked. With them a traversal follows
+// several stretches of the list at once, so their cache misses overlap.
+template <typename T, typename Allocator, typename Statistics>
+LinkedList<T, Allocator, Statistics>& LinkedList<T, Allocator, Statistics>::setPrefetching(
+    const bool enabled) {
+  if (!enabled)
+    this->jumpTable.reset();
+  else if (!this->jumpTable)
+    this->jumpTable.reset(new JumpTable());
   return *this;
 }
 
-template <typename T>
-LinkedListIterator<T> LinkedList<T>::begin() const {
-  return LinkedListIterator<T>(this->head);
+template <typename T, typename Allocator, typename Statistics>
+const bool LinkedList<T, Allocator, Statistics>::isPrefetching() const {
+  return this->jumpTable != nullptr;
 }
 
-template <typename T>
-const Node<T>* LinkedList<T>::end() const {
-  return this->tail;
+// Calls `function` on every element in order.
+template <typename T, typename Allocator, typename Statistics>
+template <typename Function>
+LinkedList<T, Allocator, Statistics>& LinkedList<T, Allocator, Statistics>::forEach(
+    Function function) {
+  Traversal walk(*this);
+  while (Node<T>* current = walk.next()) function(current->data);
+  return *this;
 }
 
-template <typename T>
-const bool LinkedList<T>::operator==(const LinkedList<T>& other) const {
+template <typename T, typename Allocator, typename Statistics>
+template <typename Function>
+const LinkedList<T, Allocator, Statistics>& LinkedList<T, Allocator, Statistics>::forEach(
+    Function function) const {
+  Traversal walk(*this);
+  while (const Node<T>* current = walk.next()) function(current->data);
+  return *this;
+}
+
+// Moves the nodes into one contiguous allocation in list order, so that scans
+// read memory front to back instead of missing the cache on every node of a
+// list whose nodes are scattered across the heap. O(n), and the elements are
+// moved, or copied if moving them could throw. Ends any pass in progress.
+// Removing nodes afterwards frees the block only once all of its nodes are
+// gone, so a list that later shrinks a lot is better relaid out again.
+template <typename T, typename Allocator, typename Statistics>
+LinkedList<T, Allocator, Statistics>& LinkedList<T, Allocator, Statistics>::relayout() {
+  if (this->layout) this->endRelayout();
+  this->relayout(this->length);
+  return *this;
+}
+
+// Incremental relayout, which moves at most `budget` nodes per call to bound
+// the pause. The first call allocates a block for the current length, and
+// each call carries on from the last node it placed. Returns true once the
+// pass has reached the tail or filled the block. The list can be used and
+// changed between calls; removing the last node placed or handing nodes over
+// to another list ends the pass, and nodes inserted among the placed ones are
+// left where they are.
+template <typename T, typename Allocator, typename Statistics>
+const bool LinkedList<T, Allocator, Statistics>::relayout(const std::size_t budget) {
+  if (!this->layout) this->layout.reset(new Layout());
+  Layout& layout = *this->layout;
+  if (!layout.filling) {
+    if (this->isEmpty() || !budget) return this->isEmpty();
+    layout.blocks.reserve(layout.blocks.size() + 1);
+    std::shared_ptr<NodeBlock> filling(new NodeBlock{nullptr, 0, 0});
+    filling->first = NodeTraits::allocate(this->allocator, this->length);
+    filling->count = this->length;
+    layout.blocks.push_back(filling);
+    layout.filling = filling;
+  }
+  NodeBlock& block = *layout.filling;
+  this->dropJumps();
+  Node<T>* current = layout.previous ? layout.previous->next : this->head;
+  for (std::size_t moved = 0; moved < budget && current && layout.placed < block.count;
+       ++moved) {
+    Node<T>* placed = block.first + layout.placed;
+    NodeTraits::construct(this->allocator, placed, std::in_place,
+                          std::move_if_noexcept(current->data));
+    ++layout.placed;
+    ++block.live;
+    placed->next = current->next;
+    if (layout.previous)
+      layout.previous->next = placed;
+    else
+      this->head = placed;
+    if (this->tail == current) this->tail = placed;
+    if (this->cursorNode == current) this->cursorNode = placed;
+    layout.previous = placed;
+    NodeTraits::destroy(this->allocator, current);
+    if (!this->releaseNode(current)) NodeTraits::deallocate(this->allocator, current, 1);
+    current = placed->next;
+  }
+  if (current && layout.placed < block.count) return false;
+  this->endRelayout();
+  return true;
+}
+
+// Applies `function` to every element, splitting the list into segments that
+// run on `pool`. Calls on different elements may run concurrently.
+template <typename T, typename Allocator, typename Statistics>
+template <typename Function>
+LinkedList<T, Allocator, Statistics>& LinkedList<T, Allocator, Statistics>::parallelForEach(
+    Function function, ThreadPool& pool) {
+  const std::vector<Node<T>*> starts = this->segments(pool);
+  pool.run(starts.size() - 1, [&](const std::size_t segment) {
+    for (Node<T>* current = starts[segment]; current != starts[segment + 1];
+         current = current->next)
+      function(current->data);
+  });
+  return *this;
+}
+
+// Returns the list of function(element) in order. Each segment builds its
+// own list, and the pieces are spliced together at the end.
+template <typename T, typename Allocator, typename Statistics>
+template <typename Function>
+auto LinkedList<T, Allocator, Statistics>::parallelTransform(Function function,
+                                                            ThreadPool& pool) const
+    -> LinkedList<TransformResult<Function>> {
+  using Result = TransformResult<Function>;
+  const std::vector<Node<T>*> starts = this->segments(pool);
+  std::vector<LinkedList<Result>> pieces(starts.size() - 1);
+  pool.run(pieces.size(), [&](const std::size_t segment) {
+    for (Node<T>* current = starts[segment]; current != starts[segment + 1];
+         current = current->next)
+      pieces[segment].emplaceBack(function(current->data));
+  });
+  LinkedList<Result> result;
+  for (LinkedList<Result>& piece : pieces) result.splice(std::move(piece));
+  return result;
+}
+
+// Folds the elements into `initial` with `operation`, which must be
+// associative: each segment is folded separately and the partial results are
+// combined in list order, so the order of operands is kept.
+template <typename T, typename Allocator, typename Statistics>
+template <typename BinaryOperation>
+T LinkedList<T, Allocator, Statistics>::parallelReduce(T initial, BinaryOperation operation,
+                                                       ThreadPool& pool) const {
+  const std::vector<Node<T>*> starts = this->segments(pool);
+  std::vector<std::unique_ptr<T>> partials(starts.size() - 1);
+  pool.run(partials.size(), [&](const std::size_t segment) {
+    Node<T>* current = starts[segment];
+    T partial(current->data);
+    for (current = current->next; current != starts[segment + 1]; current = current->next)
+      partial = operation(std::move(partial), current->data);
+    partials[segment].reset(new T(std::move(partial)));
+  });
+  for (std::unique_ptr<T>& partial : partials)
+    initial = operation(std::move(initial), std::move(*partial));
+  return initial;
+}
+
+// Stable bottom-up merge sort that relinks nodes; nothing is allocated or
+// copied. bins[i] holds a sorted run of 2^i nodes; each node taken from the
+// front is carried upward like a binary counter, with the older run always on
+// the left of a merge so equal elements keep their order.
+template <typename T, typename Allocator, typename Statistics>
+template <typename Compare>
+LinkedList<T, Allocator, Statistics>& LinkedList<T, Allocator, Statistics>::sort(Compare less) {
+  Chain bins[64] = {};
+  std::size_t used = 0;
+  Node<T>* current = this->head;
+  while (current) {
+    Chain run{current, current};
+    current = current->next;
+    run.first->next = nullptr;
+    std::size_t bin = 0;
+    for (; bin < used && bins[bin].first; ++bin) {
+      run = mergeChains(bins[bin], run, less);
+      bins[bin] = Chain{nullptr, nullptr};
+    }
+    if (bin == used) ++used;
+    bins[bin] = run;
+  }
+  Chain sorted{nullptr, nullptr};
+  for (std::size_t bin = 0; bin < used; ++bin) sorted = mergeChains(bins[bin], sorted, less);
+  this->dropJumps();
+  this->head = sorted.first;
+  this->tail = sorted.last;
+  this->resetCursor();
+  return *this;
+}
+
+// Merges another sorted list into this sorted one, relinking its nodes. On
+// ties the elements of this list come first. Lists with unequal allocators
+// have their elements moved instead.
+template <typename T, typename Allocator, typename Statistics>
+template <typename Compare>
+LinkedList<T, Allocator, Statistics>& LinkedList<T, Allocator, Statistics>::merge(
+    LinkedList&& other, Compare less) {
+  if (this == &other) return *this;
+  if (this->allocator != other.allocator) {
+    LinkedList<T, Allocator, Statistics> moved(this->getAllocator());
+    moved.splice(std::move(other));
+    return this->merge(std::move(moved), less);
+  }
+  Chain merged =
+      mergeChains(Chain{this->head, this->tail}, Chain{other.head, other.tail}, less);
+  this->head = merged.first;
+  this->tail = merged.last;
+  this->length += other.length;
+  this->resetCursor();
+  this->dropJumps();
+  other.dropJumps();
+  other.handOver(*this, other.length);
+  other.head = nullptr;
+  other.tail = nullptr;
+  other.length = 0;
+  other.resetCursor();
+  return *this;
+}
+
+// Removes every element equal to the one before it, so a sorted list ends up
+// without duplicates.
+template <typename T, typename Allocator, typename Statistics>
+template <typename BinaryPredicate>
+LinkedList<T, Allocator, Statistics>& LinkedList<T, Allocator, Statistics>::unique(
+    BinaryPredicate same) {
+  Node<T>* current = this->head;
+  while (current && current->next) {
+    Node<T>* next = current->next;
+    if (same(current->data, next->data)) {
+      current->next = next->next;
+      if (this->tail == next) this->tail = current;
+      this->destroyNode(next);
+      --this->length;
+    } else {
+      current = next;
+    }
+  }
+  this->resetCursor();
+  return *this;
+}
+
+template <typename T, typename Allocator, typename Statistics>
+typename LinkedList<T, Allocator, Statistics>::iterator
+LinkedList<T, Allocator, Statistics>::begin() {
+  return iterator(this->head);
+}
+
+template <typename T, typename Allocator, typename Statistics>
+typename LinkedList<T, Allocator, Statistics>::iterator
+LinkedList<T, Allocator, Statistics>::end() {
+  return iterator(nullptr);
+}
+
+template <typename T, typename Allocator, typename Statistics>
+typename LinkedList<T, Allocator, Statistics>::const_iterator
+LinkedList<T, Allocator, Statistics>::begin() const {
+  return const_iterator(this->head);
+}
+
+template <typename T, typename Allocator, typename Statistics>
+typename LinkedList<T, Allocator, Statistics>::const_iterator
+LinkedList<T, Allocator, Statistics>::end() const {
+  return const_iterator(nullptr);
+}
+
+template <typename T, typename Allocator, typename Statistics>
+typename LinkedList<T, Allocator, Statistics>::const_iterator
+LinkedList<T, Allocator, Statistics>::cbegin() const {
+  return const_iterator(this->head);
+}
+
+template <typename T, typename Allocator, typename Statistics>
+typename LinkedList<T, Allocator, Statistics>::const_iterator
+LinkedList<T, Allocator, Statistics>::cend() const {
+  return const_iterator(nullptr);
+}
+
+template <typename T, typename Allocator, typename Statistics>
+const bool LinkedList<T, Allocator, Statistics>::operator==(const LinkedList& other) const {
   if (this == &other) return true;
-  if (this->tail->data != other.tail->data || this->length != other.length)
-    return false;
-  Node<T>* thisCurrent = this->head;
-  Node<T>* otherCurrent = other.head;
+  if (this->length != other.length) return false;
+  if (this->tail && this->tail->data != other.tail->data) return false;
+  Traversal thisWalk(*this);
+  Traversal otherWalk(other);
+  Node<T>* thisCurrent = thisWalk.next();
+  Node<T>* otherCurrent = otherWalk.next();
   while (thisCurrent && otherCurrent) {
     if (thisCurrent->data != otherCurrent->data) return false;
-    thisCurrent = thisCurrent->next;
-    otherCurrent = otherCurrent->next;
+    thisCurrent = thisWalk.next();
+    otherCurrent = otherWalk.next();
   }
   return !(thisCurrent || otherCurrent);
 }
 
-template <typename T>
-const bool LinkedList<T>::operator!=(const LinkedList& other) const {
+template <typename T, typename Allocator, typename Statistics>
+const bool LinkedList<T, Allocator, Statistics>::operator!=(const LinkedList& other) const {
   return !this->operator==(other);
 }
 
-template <typename T>
-const T& LinkedList<T>::operator[](const std::size_t index) const {
-  if (index >= this->length)
-    throw ListIndexOutOfBounds(index, this->length);
-  else if (index == this->length - 1)
-    return this->tail->data;
-  else {
-    Node<T>* current = this->head;
-    std::size_t position = 0;
-    while (position < index) {
-      current = current->next;
-      ++position;
+template <typename T, typename Allocator, typename Statistics>
+const T& LinkedList<T, Allocator, Statistics>::operator[](const std::size_t index) const {
+  if (index >= this->length) throw ListIndexOutOfBounds(index, this->length);
+  return this->nodeAt(index, ListWalk::Access)->data;
+}
+
+template <typename T, typename Allocator, typename Statistics>
+T& LinkedList<T, Allocator, Statistics>::operator[](const std::size_t index) {
+  if (index >= this->length) throw ListIndexOutOfBounds(index, this->length);
+  return this->nodeAt(index, ListWalk::Access)->data;
+}
+
+// Merges two sorted chains, taking from `a` on ties.
+template <typename T, typename Allocator, typename Statistics>
+template <typename Compare>
+typename LinkedList<T, Allocator, Statistics>::Chain
+LinkedList<T, Allocator, Statistics>::mergeChains(Chain a, Chain b, Compare& less) {
+  Node<T>* first = nullptr;
+  Node<T>** link = &first;
+  while (a.first && b.first) {
+    if (less(b.first->data, a.first->data)) {
+      *link = b.first;
+      b.first = b.first->next;
+    } else {
+      *link = a.first;
+      a.first = a.first->next;
     }
-    return current->data;
+    link = &(*link)->next;
+  }
+  if (a.first) {
+    *link = a.first;
+    return Chain{first, a.last};
   }
+  *link = b.first;
+  return Chain{first, b.last};
 }
 
-template <typename T>
-T& LinkedList<T>::operator[](const std::size_t index) {
-  if (index >= this->length)
-    throw ListIndexOutOfBounds(index, this->length);
-  else if (index == this->length - 1)
-    return this->tail->data;
-  else {
+// Cuts the list into a few segments per thread of `pool` with one walk,
+// returning the first node of each segment followed by null. An empty list
+// has no segments.
+template <typename T, typename Allocator, typename Statistics>
+std::vector<Node<T>*> LinkedList<T, Allocator, Statistics>::segments(const ThreadPool& pool) const {
+  const std::size_t count = std::min(this->length, 4 * (pool.size() + 1));
+  std::vector<Node<T>*> starts;
+  starts.reserve(count + 1);
+  Node<T>* current = this->head;
+  for (std::size_t segment = 0, position = 0; segment < count; ++segment) {
+    for (; position < segment * this->length / count; ++position) current = current->next;
+    starts.push_back(current);
+  }
+  starts.push_back(nullptr);
+  return starts;
+}
+
+// Walks forward from the cursor when it is at or before the index, and from
+// head otherwise, then leaves the cursor on the node found.
+template <typename T, typename Allocator, typename Statistics>
+Node<T>* LinkedList<T, Allocator, Statistics>::nodeAt(const std::size_t index,
+                                                     const ListWalk kind) const {
+  if (index == this->length - 1) {
+    this->Statistics::walked(kind, 0);
+    return this->tail;
+  }
+  Node<T>* current = this->head;
+  std::size_t position = 0;
+  if (this->cursorNode && this->cursorIndex <= index) {
+    current = this->cursorNode;
+    position = this->cursorIndex;
+  }
+  this->Statistics::walked(kind, index - position);
+  while (position < index) {
+    current = current->next;
+    ++position;
+  }
+  this->cursorNode = current;
+  this->cursorIndex = index;
+  return current;
+}
+
+// Links the chain first..last of `count` nodes in front of position `index`,
+// recording the walk to it as `kind`.
+template <typename T, typename Allocator, typename Statistics>
+void LinkedList<T, Allocator, Statistics>::linkChain(const std::size_t index, Node<T>* first,
+                                                     Node<T>* last, const std::size_t count,
+                                                     const ListWalk kind) {
+  if (index == 0) {
+    last->next = this->head;
+    this->head = first;
+    if (!this->tail) this->tail = last;
+    if (this->cursorNode) this->cursorIndex += count;
+  } else {
+    Node<T>* prior = this->nodeAt(index - 1, kind);
+    last->next = prior->next;
+    prior->next = first;
+    if (this->tail == prior) this->tail = last;
+  }
+  this->length += count;
+}
+
+// Creates a node for each element of [first, last), linked in order but not
+// part of the list yet, and sets `count` to their number. Destroys them all
+// if one fails.
+template <typename T, typename Allocator, typename Statistics>
+template <typename InputIt>
+typename LinkedList<T, Allocator, Statistics>::Chain
+LinkedList<T, Allocator, Statistics>::createChain(InputIt first, InputIt last,
+                                                  std::size_t& count) {
+  reserveNodes(this->allocator, first, last, 0);
+  Chain chain{nullptr, nullptr};
+  try {
+    for (; first != last; ++first) {
+      Node<T>* node = this->createNode(*first);
+      if (chain.last)
+        chain.last->next = node;
+      else
+        chain.first = node;
+      chain.last = node;
+      ++count;
+    }
+  } catch (...) {
+    while (chain.first) {
+      Node<T>* next = chain.first->next;
+      this->destroyNode(chain.first);
+      chain.first = next;
+    }
+    count = 0;
+    throw;
+  }
+  return chain;
+}
+
+// Asks allocators that offer reserve(), such as SlabAllocator, to prepare for
+// the nodes of a forward range. Other allocators and input ranges, which can
+// only be read once, are left alone.
+template <typename T, typename Allocator, typename Statistics>
+template <typename Pool, typename InputIt>
+auto LinkedList<T, Allocator, Statistics>::reserveNodes(Pool& pool, InputIt first, InputIt last,
+                                                        int)
+    -> decltype(std::declval<Pool&>().reserve(0), void()) {
+  if (std::is_base_of<std::forward_iterator_tag, IteratorCategory<InputIt>>::value)
+    pool.reserve(std::distance(first, last));
+}
+
+template <typename T, typename Allocator, typename Statistics>
+template <typename Pool, typename InputIt>
+void LinkedList<T, Allocator, Statistics>::reserveNodes(Pool&, InputIt, InputIt, long) {}
+
+// The jump pointers of a prefetching list worth at least two segments,
+// retaken once the list has doubled since they were. Null otherwise.
+template <typename T, typename Allocator, typename Statistics>
+const std::vector<Node<T>*>* LinkedList<T, Allocator, Statistics>::currentJumps() const {
+  JumpTable* table = this->jumpTable.get();
+  if (!table || this->length < 2 * jumpStride) return nullptr;
+  if (table->jumps.empty() || this->length >= 2 * table->builtLength) {
+    table->jumps.clear();
+    table->jumps.reserve(this->length / jumpStride);
     Node<T>* current = this->head;
-    std::size_t position = 0;
-    while (position < index) {
+    for (std::size_t position = 1; position < this->length; ++position) {
       current = current->next;
-      ++position;
+      if (position % jumpStride == 0) table->jumps.push_back(current);
+    }
+    table->builtLength = this->length;
+  }
+  return &table->jumps;
+}
+
+// Called whenever nodes leave the list or change order, which can leave a
+// jump pointer dangling or out of order.
+template <typename T, typename Allocator, typename Statistics>
+void LinkedList<T, Allocator, Statistics>::dropJumps() {
+  if (this->jumpTable) this->jumpTable->jumps.clear();
+}
+
+template <typename T, typename Allocator, typename Statistics>
+void LinkedList<T, Allocator, Statistics>::resetCursor() const {
+  this->cursorNode = nullptr;
+  this->cursorIndex = 0;
+}
+
+template <typename T, typename Allocator, typename Statistics>
+template <typename... Args>
+Node<T>* LinkedList<T, Allocator, Statistics>::createNode(Args&&... args) {
+  Node<T>* node = NodeTraits::allocate(this->allocator, 1);
+  try {
+    NodeTraits::construct(this->allocator, node, std::in_place,
+                          std::forward<Args>(args)...);
+  } catch (...) {
+    NodeTraits::deallocate(this->allocator, node, 1);
+    throw;
+  }
+  this->Statistics::allocated(sizeof(Node<T>));
+  return node;
+}
+
+template <typename T, typename Allocator, typename Statistics>
+void LinkedList<T, Allocator, Statistics>::destroyNode(Node<T>* node) {
+  NodeTraits::destroy(this->allocator, node);
+  if (!this->layout || !this->releaseNode(node))
+    NodeTraits::deallocate(this->allocator, node, 1);
+  this->Statistics::freed(sizeof(Node<T>));
+  this->dropJumps();
+}
+
+// Tells both lists' statistics that `count` nodes moved from this list to
+// `other`. Ends this list's relayout pass, and shares its blocks with `other`
+// in case some of the nodes came from them. The move constructor takes the
+// blocks along before calling it.
+template <typename T, typename Allocator, typename Statistics>
+void LinkedList<T, Allocator, Statistics>::handOver(LinkedList& other, const std::size_t count) {
+  this->Statistics::released(count * sizeof(Node<T>));
+  other.Statistics::adopted(count * sizeof(Node<T>));
+  if (!this->layout) return;
+  this->endRelayout();
+  if (this->layout->blocks.empty()) return;
+  if (!other.layout) other.layout.reset(new Layout());
+  std::vector<std::shared_ptr<NodeBlock>>& blocks = other.layout->blocks;
+  for (const std::shared_ptr<NodeBlock>& block : this->layout->blocks)
+    if (std::find(blocks.begin(), blocks.end(), block) == blocks.end()) blocks.push_back(block);
+}
+
+// Returns a destroyed node to the relayout block it is in, freeing the block
+// with its last node. False if the node is in none of this list's blocks.
+template <typename T, typename Allocator, typename Statistics>
+const bool LinkedList<T, Allocator, Statistics>::releaseNode(Node<T>* node) {
+  Layout& layout = *this->layout;
+  for (std::size_t i = 0; i < layout.blocks.size(); ++i) {
+    const NodeBlock& candidate = *layout.blocks[i];
+    if (node < candidate.first || node >= candidate.first + candidate.count) continue;
+    const std::shared_ptr<NodeBlock> block = layout.blocks[i];
+    if (node == layout.previous) this->endRelayout();
+    if (--block->live == 0) {
+      NodeTraits::deallocate(this->allocator, block->first, block->count);
+      block->first = nullptr;
+      block->count = 0;
+      this->pruneBlocks();
     }
-    return current->data;
+    return true;
+  }
+  return false;
+}
+
+// Forgets the pass in progress, freeing its block if no node was placed.
+template <typename T, typename Allocator, typename Statistics>
+void LinkedList<T, Allocator, Statistics>::endRelayout() {
+  Layout& layout = *this->layout;
+  if (layout.filling && !layout.filling->live) {
+    NodeTraits::deallocate(this->allocator, layout.filling->first, layout.filling->count);
+    layout.filling->first = nullptr;
+    layout.filling->count = 0;
+  }
+  layout.filling.reset();
+  layout.placed = 0;
+  layout.previous = nullptr;
+  this->pruneBlocks();
+}
+
+// Drops the blocks that have been freed, here or by another list sharing them.
+template <typename T, typename Allocator, typename Statistics>
+void LinkedList<T, Allocator, Statistics>::pruneBlocks() {
+  std::vector<std::shared_ptr<NodeBlock>>& blocks = this->layout->blocks;
+  blocks.erase(std::remove_if(blocks.begin(), blocks.end(),
+                              [](const std::shared_ptr<NodeBlock>& block) {
+                                return !block->count;
+                              }),
+               blocks.end());
+}
+
+template <typename T, typename Allocator, typename Statistics>
+LinkedList<T, Allocator, Statistics>::Traversal::Traversal(const LinkedList& list)
+    : head(list.head),
+      jumps(list.currentJumps()),
+      upcoming(list.head),
+      warmed(0),
+      boundary(jumps ? list.head : nullptr) {}
+
+template <typename T, typename Allocator, typename Statistics>
+Node<T>* LinkedList<T, Allocator, Statistics>::Traversal::next() {
+  if (this->boundary && this->upcoming == this->boundary) this->warm();
+  Node<T>* current = this->upcoming;
+  if (current) this->upcoming = current->next;
+  return current;
+}
+
+// First node of segment `segment`: the head, then the jump pointers.
+template <typename T, typename Allocator, typename Statistics>
+Node<T>* LinkedList<T, Allocator, Statistics>::Traversal::start(const std::size_t segment) const {
+  if (segment == 0) return this->head;
+  return segment <= this->jumps->size() ? (*this->jumps)[segment - 1] : nullptr;
+}
+
+// Walks the next warmedSegments segments one link at a time each, round
+// robin, which loads their nodes into the cache with the misses in flight
+// together; that interleaving of independent chains is where the speedup
+// comes from. Each step prefetches the node its segment moves to, a round
+// before the walk reads it, which also keeps the compiler from discarding the
+// walk, whose result is otherwise unused.
+template <typename T, typename Allocator, typename Statistics>
+void LinkedList<T, Allocator, Statistics>::Traversal::warm() {
+  Node<T>* cursors[warmedSegments];
+  Node<T>* ends[warmedSegments];
+  std::size_t count = 0;
+  for (; count < warmedSegments && this->warmed + count <= this->jumps->size(); ++count) {
+    cursors[count] = this->start(this->warmed + count);
+    ends[count] = this->start(this->warmed + count + 1);
+  }
+  for (bool moved = true; moved;) {
+    moved = false;
+    for (std::size_t i = 0; i < count; ++i)
+      if (cursors[i] != ends[i]) {
+        cursors[i] = cursors[i]->next;
+        if (cursors[i]) __builtin_prefetch(cursors[i]);
+        moved = true;
+      }
   }
+  this->warmed += count;
+  this->boundary = this->start(this->warmed);
 }
 
-#endif
\ No newline at end of file
+#endif
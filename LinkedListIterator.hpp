@@ -1,26 +1,58 @@
 #ifndef LINKEDLISTITERATOR_HPP
 #define LINKEDLISTITERATOR_HPP
 
+#include <stddef.h>
+#include <iterator>
+#include <type_traits>
 #include "Node.hpp"
 
-template <typename T>
+// Forward iterator over a LinkedList. The past-the-end iterator holds a null
+// node. `Const` selects const_iterator, which a mutable iterator converts to.
+template <typename T, bool Const = false>
   class LinkedListIterator {
    public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = typename std::conditional<Const, const T*, T*>::type;
+    using reference = typename std::conditional<Const, const T&, T&>::type;
+
+    LinkedListIterator() : current(nullptr) {}
     LinkedListIterator(Node<T>* start) : current(start) {}
-    LinkedListIterator<T>& operator++() {
+    template <bool OtherConst, typename = typename std::enable_if<Const && !OtherConst>::type>
+    LinkedListIterator(const LinkedListIterator<T, OtherConst>& other)
+        : current(other.current) {}
+
+    LinkedListIterator& operator++() {
+      this->current = this->current->next;
+      return *this;
+    }
+    LinkedListIterator operator++(int) {
+      LinkedListIterator previous = *this;
       this->current = this->current->next;
+      return previous;
     }
-    T& operator*() const {
+    reference operator*() const {
       return this->current->data;
     }
-    const bool operator==(const Node<T>* other) const {
-      return this->current == other;
+    pointer operator->() const {
+      return &this->current->data;
+    }
+    template <bool OtherConst>
+    const bool operator==(const LinkedListIterator<T, OtherConst>& other) const {
+      return this->current == other.current;
     }
-    const bool operator!=(const Node<T>* other) const {
-      return this->current != other;
+    template <bool OtherConst>
+    const bool operator!=(const LinkedListIterator<T, OtherConst>& other) const {
+      return this->current != other.current;
     }
    private:
+    template <typename, typename, typename>
+    friend class LinkedList;
+    template <typename, bool>
+    friend class LinkedListIterator;
+
     Node<T>* current;
   };
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,348 @@
+#ifndef LISTFILE_HPP
+#define LISTFILE_HPP
+
+#include <errno.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+// Binary list files, written by the lists' save() and read by load() and
+// MappedList.
+//
+// A 32-byte ListFileHeader is followed by the payload. For trivially copyable
+// T the payload is the elements' bytes back to back, so the file can be read
+// in bulk or mapped. Any other T is stored as records: a 64-bit byte count
+// followed by the bytes ListRecord<T> produced. Files are in the writer's byte
+// order, which the header records so that a mismatch is refused.
+struct ListFileHeader {
+  char magic[4];
+  uint32_t byteOrder;
+  uint32_t typeTag;
+  uint32_t elementSize;
+  uint64_t length;
+  uint64_t reserved;
+};
+
+static_assert(sizeof(ListFileHeader) == 32, "ListFileHeader must stay 32 bytes");
+
+// Encodes a non-trivially-copyable element as bytes and back. Specialize it,
+// with a tag unique among record types, to save lists of other types.
+template <typename T>
+struct ListRecord;
+
+template <>
+struct ListRecord<std::string> {
+  static const uint32_t tag = 0x501;
+  static void encode(const std::string& data, std::string& bytes) { bytes = data; }
+  static std::string decode(const char* bytes, const std::size_t size) {
+    return std::string(bytes, size);
+  }
+};
+
+// Identifies the element type in the header: bool, the kind of arithmetic
+// type and its size, a generic tag for other trivially copyable types (whose
+// size is checked separately), or the record tag. Character types share the
+// tag of the integers of their size and signedness.
+template <typename T, bool Trivial = std::is_trivially_copyable<T>::value>
+struct ListTypeTag {
+  static const uint32_t value =
+      std::is_same<T, bool>::value       ? 0x001
+      : std::is_floating_point<T>::value ? 0x300 + sizeof(T)
+      : std::is_integral<T>::value       ? (std::is_signed<T>::value ? 0x100 : 0x200) + sizeof(T)
+                                         : 0x400;
+};
+
+template <typename T>
+struct ListTypeTag<T, false> {
+  static const uint32_t value = ListRecord<T>::tag;
+};
+
+// Streams a list to a file. The file is written under a temporary name and
+// renamed over `path` by finish(), so an interrupted save leaves any earlier
+// file intact.
+template <typename T>
+class ListFileWriter {
+ public:
+  ListFileWriter(const std::string&, const std::size_t);
+  ListFileWriter(const ListFileWriter&) = delete;
+  ListFileWriter& operator=(const ListFileWriter&) = delete;
+  ~ListFileWriter();
+
+  void write(const T&);
+  void write(const T*, const std::size_t);
+  void finish();
+
+ private:
+  void writeElement(const T&, std::true_type);
+  void writeElement(const T&, std::false_type);
+  void put(const void*, const std::size_t);
+  void flush();
+  void fail(const char*);
+
+  std::string path;
+  std::string temporary;
+  FILE* file;
+  std::size_t length;
+  std::size_t written;
+  std::vector<char> buffer;
+  std::string record;
+};
+
+// Reads back a file written by ListFileWriter<T>, one element or one bulk run
+// at a time. The element count in the header is checked against the size of
+// the file when it is opened.
+template <typename T>
+class ListFileReader {
+ public:
+  explicit ListFileReader(const std::string&);
+  ListFileReader(const ListFileReader&) = delete;
+  ListFileReader& operator=(const ListFileReader&) = delete;
+  ~ListFileReader();
+
+  const std::size_t size() const;
+  T next();
+  void read(T*, const std::size_t);
+
+ private:
+  T readElement(std::true_type);
+  T readElement(std::false_type);
+  void take(void*, const std::size_t);
+  void fail(const char*);
+
+  std::string path;
+  FILE* file;
+  std::size_t length;
+  std::size_t consumed;
+  std::size_t unread;
+  std::vector<char> buffer;
+  std::size_t bufferStart;
+  std::size_t bufferEnd;
+  std::string record;
+};
+
+// Fills and checks a header for T.
+template <typename T>
+ListFileHeader listFileHeader(const std::size_t length) {
+  ListFileHeader header = {{'L', 'S', 'T', '1'},
+                           0x01020304,
+                           ListTypeTag<T>::value,
+                           std::is_trivially_copyable<T>::value ? uint32_t(sizeof(T)) : 0,
+                           length,
+                           0};
+  return header;
+}
+
+template <typename T>
+void checkListFileHeader(const ListFileHeader& header, const std::string& path) {
+  const ListFileHeader expected = listFileHeader<T>(0);
+  if (std::memcmp(header.magic, expected.magic, sizeof(header.magic)) != 0)
+    throw std::runtime_error(path + " is not a list file");
+  if (header.byteOrder != expected.byteOrder)
+    throw std::runtime_error(path + " was written with a different byte order");
+  if (header.typeTag != expected.typeTag || header.elementSize != expected.elementSize)
+    throw std::runtime_error(path + " holds a different element type");
+}
+
+template <typename T>
+ListFileWriter<T>::ListFileWriter(const std::string& path, const std::size_t length)
+    : path(path), temporary(path + ".tmp"), file(nullptr), length(length), written(0) {
+  this->file = fopen(this->temporary.c_str(), "wb");
+  if (!this->file) this->fail("cannot create");
+  this->buffer.reserve(1 << 16);
+  const ListFileHeader header = listFileHeader<T>(length);
+  this->put(&header, sizeof(header));
+}
+
+// Abandons an unfinished file.
+template <typename T>
+ListFileWriter<T>::~ListFileWriter() {
+  if (this->file) {
+    fclose(this->file);
+    remove(this->temporary.c_str());
+  }
+}
+
+template <typename T>
+void ListFileWriter<T>::write(const T& data) {
+  if (this->written == this->length) throw std::logic_error("more elements than announced");
+  ++this->written;
+  this->writeElement(data, std::is_trivially_copyable<T>());
+}
+
+template <typename T>
+void ListFileWriter<T>::write(const T* values, const std::size_t count) {
+  if (count > this->length - this->written) throw std::logic_error("more elements than announced");
+  if (!std::is_trivially_copyable<T>::value) {
+    for (std::size_t i = 0; i < count; ++i) this->write(values[i]);
+    return;
+  }
+  this->flush();
+  if (count && fwrite(values, sizeof(T), count, this->file) != count) this->fail("cannot write");
+  this->written += count;
+}
+
+template <typename T>
+void ListFileWriter<T>::writeElement(const T& data, std::true_type) {
+  this->put(&data, sizeof(T));
+}
+
+template <typename T>
+void ListFileWriter<T>::writeElement(const T& data, std::false_type) {
+  ListRecord<T>::encode(data, this->record);
+  const uint64_t size = this->record.size();
+  this->put(&size, sizeof(size));
+  this->put(this->record.data(), this->record.size());
+}
+
+template <typename T>
+void ListFileWriter<T>::finish() {
+  if (this->written != this->length) throw std::logic_error("fewer elements than announced");
+  this->flush();
+  FILE* file = this->file;
+  this->file = nullptr;
+  if (fclose(file) != 0) {
+    remove(this->temporary.c_str());
+    this->fail("cannot write");
+  }
+  if (rename(this->temporary.c_str(), this->path.c_str()) != 0) {
+    remove(this->temporary.c_str());
+    this->fail("cannot replace");
+  }
+}
+
+template <typename T>
+void ListFileWriter<T>::put(const void* bytes, const std::size_t size) {
+  if (this->buffer.size() + size > this->buffer.capacity()) this->flush();
+  if (size > this->buffer.capacity()) {
+    if (fwrite(bytes, 1, size, this->file) != size) this->fail("cannot write");
+    return;
+  }
+  const char* begin = static_cast<const char*>(bytes);
+  this->buffer.insert(this->buffer.end(), begin, begin + size);
+}
+
+template <typename T>
+void ListFileWriter<T>::flush() {
+  if (this->buffer.empty()) return;
+  if (fwrite(this->buffer.data(), 1, this->buffer.size(), this->file) != this->buffer.size())
+    this->fail("cannot write");
+  this->buffer.clear();
+}
+
+template <typename T>
+void ListFileWriter<T>::fail(const char* what) {
+  throw std::runtime_error(std::string(what) + " " + this->path + ": " + std::strerror(errno));
+}
+
+template <typename T>
+ListFileReader<T>::ListFileReader(const std::string& path)
+    : path(path), file(nullptr), length(0), consumed(0), unread(0), bufferStart(0), bufferEnd(0) {
+  this->file = fopen(path.c_str(), "rb");
+  if (!this->file) this->fail("cannot open");
+  // The destructor does not run when the constructor throws.
+  try {
+    if (fseek(this->file, 0, SEEK_END) != 0) this->fail("cannot read");
+    const long end = ftell(this->file);
+    if (end < 0) this->fail("cannot read");
+    this->unread = end;
+    rewind(this->file);
+    this->buffer.resize(1 << 16);
+    ListFileHeader header;
+    this->take(&header, sizeof(header));
+    checkListFileHeader<T>(header, path);
+    // Every element takes at least its own bytes, or a record's byte count,
+    // so callers can size buffers from size().
+    const std::size_t least =
+        std::is_trivially_copyable<T>::value ? sizeof(T) : sizeof(uint64_t);
+    if (header.length > this->unread / least) throw std::runtime_error(path + " is truncated");
+    this->length = header.length;
+  } catch (...) {
+    fclose(this->file);
+    throw;
+  }
+}
+
+template <typename T>
+ListFileReader<T>::~ListFileReader() {
+  if (this->file) fclose(this->file);
+}
+
+template <typename T>
+const std::size_t ListFileReader<T>::size() const {
+  return this->length;
+}
+
+template <typename T>
+T ListFileReader<T>::next() {
+  if (this->consumed == this->length) throw std::logic_error("read past the last element");
+  ++this->consumed;
+  return this->readElement(std::is_trivially_copyable<T>());
+}
+
+template <typename T>
+T ListFileReader<T>::readElement(std::true_type) {
+  typename std::aligned_storage<sizeof(T), alignof(T)>::type raw;
+  this->take(&raw, sizeof(T));
+  return *reinterpret_cast<T*>(&raw);
+}
+
+template <typename T>
+T ListFileReader<T>::readElement(std::false_type) {
+  uint64_t size;
+  this->take(&size, sizeof(size));
+  // A damaged size must not turn into a huge allocation.
+  if (size > this->unread) throw std::runtime_error(this->path + " is truncated");
+  this->record.resize(size);
+  this->take(&this->record[0], size);
+  return ListRecord<T>::decode(this->record.data(), size);
+}
+
+// Reads `count` elements of a trivially copyable T straight into `target`,
+// which may be uninitialized storage.
+template <typename T>
+void ListFileReader<T>::read(T* target, const std::size_t count) {
+  static_assert(std::is_trivially_copyable<T>::value, "bulk reads need a trivially copyable T");
+  if (count > this->length - this->consumed) throw std::logic_error("read past the last element");
+  this->take(target, count * sizeof(T));
+  this->consumed += count;
+}
+
+// Copies the next `size` bytes of the file, going around the buffer for
+// large runs.
+template <typename T>
+void ListFileReader<T>::take(void* target, const std::size_t size) {
+  if (size > this->unread) throw std::runtime_error(this->path + " is truncated");
+  this->unread -= size;
+  char* out = static_cast<char*>(target);
+  std::size_t left = size;
+  while (left) {
+    if (this->bufferStart == this->bufferEnd) {
+      if (left >= this->buffer.size()) {
+        if (fread(out, 1, left, this->file) != left) this->fail("cannot read");
+        return;
+      }
+      this->bufferStart = 0;
+      this->bufferEnd = fread(this->buffer.data(), 1, this->buffer.size(), this->file);
+      if (this->bufferEnd == 0) this->fail("cannot read");
+    }
+    const std::size_t run = std::min(left, this->bufferEnd - this->bufferStart);
+    std::memcpy(out, this->buffer.data() + this->bufferStart, run);
+    this->bufferStart += run;
+    out += run;
+    left -= run;
+  }
+}
+
+template <typename T>
+void ListFileReader<T>::fail(const char* what) {
+  if (this->file && feof(this->file)) throw std::runtime_error(this->path + " is truncated");
+  throw std::runtime_error(std::string(what) + " " + this->path + ": " + std::strerror(errno));
+}
+
+#endif
@@ -0,0 +1,191 @@
+#ifndef LISTSTATISTICS_HPP
+#define LISTSTATISTICS_HPP
+
+#include <stddef.h>
+#include <stdint.h>
+#include <ostream>
+
+// Statistics policies for LinkedList, given as its third template parameter.
+// The list reports node allocations and frees, nodes moved in from or out to
+// another list, and every positional walk with the number of links followed.
+// A policy is any class with the hooks of NoListStatistics. walked() is called
+// by const accessors too, so it is const and whatever it updates is mutable.
+// A custom policy can also record where a long walk came from, for example by
+// capturing a stack trace in walked() when the walk exceeds some length.
+
+// Positional walks, by the operation that made them.
+enum class ListWalk { Access, Insert, Remove, Unappend, Splice, Split };
+
+// Default policy: every hook is empty and inlines to nothing, and a list
+// holding it is no larger than one without statistics.
+struct NoListStatistics {
+  void allocated(const std::size_t) {}
+  void freed(const std::size_t) {}
+  void adopted(const std::size_t) {}
+  void released(const std::size_t) {}
+  void walked(const ListWalk, const std::size_t) const {}
+};
+
+// Counting policy: allocations, frees and live bytes, plus for each kind of
+// walk the number of walks, the links followed and a histogram of walk
+// lengths in power-of-two buckets. Bucket 0 counts walks that followed no
+// link, and bucket b > 0 those that followed [2^(b-1), 2^b) links.
+class ListStatistics {
+ public:
+  static const std::size_t walkKinds = 6;
+  static const std::size_t buckets = 64;
+
+  ListStatistics();
+
+  // Hooks
+  void allocated(const std::size_t);
+  void freed(const std::size_t);
+  void adopted(const std::size_t);
+  void released(const std::size_t);
+  void walked(const ListWalk, const std::size_t) const;
+
+  // Getters
+  const uint64_t getAllocations() const;
+  const uint64_t getFrees() const;
+  const std::size_t getLiveBytes() const;
+  const std::size_t getPeakBytes() const;
+  const uint64_t getWalks(const ListWalk) const;
+  const uint64_t getNodesWalked(const ListWalk) const;
+  const std::size_t getLongestWalk(const ListWalk) const;
+  const uint64_t getWalkLengths(const ListWalk, const std::size_t) const;
+
+  void reset();
+  // Writes a line with the memory counters and one per kind of walk made.
+  void dump(std::ostream&) const;
+
+ private:
+  struct Walks {
+    uint64_t count;
+    uint64_t nodes;
+    std::size_t longest;
+    uint64_t lengths[buckets];
+  };
+
+  static const char* name(const ListWalk);
+  static const std::size_t bucketOf(const std::size_t);
+
+  uint64_t allocations;
+  uint64_t frees;
+  std::size_t liveBytes;
+  std::size_t peakBytes;
+  mutable Walks walks[walkKinds];
+};
+
+inline ListStatistics::ListStatistics() : liveBytes(0) {
+  this->reset();
+}
+
+inline void ListStatistics::allocated(const std::size_t bytes) {
+  ++this->allocations;
+  this->adopted(bytes);
+}
+
+inline void ListStatistics::freed(const std::size_t bytes) {
+  ++this->frees;
+  this->released(bytes);
+}
+
+// Nodes linked in from another list.
+inline void ListStatistics::adopted(const std::size_t bytes) {
+  this->liveBytes += bytes;
+  if (this->liveBytes > this->peakBytes) this->peakBytes = this->liveBytes;
+}
+
+// Nodes handed over to another list.
+inline void ListStatistics::released(const std::size_t bytes) {
+  this->liveBytes -= bytes;
+}
+
+inline void ListStatistics::walked(const ListWalk kind, const std::size_t nodes) const {
+  Walks& walks = this->walks[std::size_t(kind)];
+  ++walks.count;
+  walks.nodes += nodes;
+  if (nodes > walks.longest) walks.longest = nodes;
+  ++walks.lengths[bucketOf(nodes)];
+}
+
+inline const uint64_t ListStatistics::getAllocations() const {
+  return this->allocations;
+}
+
+inline const uint64_t ListStatistics::getFrees() const {
+  return this->frees;
+}
+
+inline const std::size_t ListStatistics::getLiveBytes() const {
+  return this->liveBytes;
+}
+
+inline const std::size_t ListStatistics::getPeakBytes() const {
+  return this->peakBytes;
+}
+
+inline const uint64_t ListStatistics::getWalks(const ListWalk kind) const {
+  return this->walks[std::size_t(kind)].count;
+}
+
+inline const uint64_t ListStatistics::getNodesWalked(const ListWalk kind) const {
+  return this->walks[std::size_t(kind)].nodes;
+}
+
+inline const std::size_t ListStatistics::getLongestWalk(const ListWalk kind) const {
+  return this->walks[std::size_t(kind)].longest;
+}
+
+inline const uint64_t ListStatistics::getWalkLengths(const ListWalk kind,
+                                                     const std::size_t bucket) const {
+  return bucket < buckets ? this->walks[std::size_t(kind)].lengths[bucket] : 0;
+}
+
+// Clears the counters. The live bytes describe the list rather than its
+// history, so they are kept, and the peak restarts from them.
+inline void ListStatistics::reset() {
+  this->allocations = 0;
+  this->frees = 0;
+  this->peakBytes = this->liveBytes;
+  for (Walks& walks : this->walks) walks = Walks();
+}
+
+// For example:
+//   allocations 12, frees 2, live bytes 160, peak bytes 192
+//   unappend: 4 walks, 30 nodes, longest 9, lengths 4-7:2 8-15:2
+inline void ListStatistics::dump(std::ostream& output) const {
+  output << "allocations " << this->allocations << ", frees " << this->frees << ", live bytes "
+         << this->liveBytes << ", peak bytes " << this->peakBytes << "\n";
+  for (std::size_t kind = 0; kind < walkKinds; ++kind) {
+    const Walks& walks = this->walks[kind];
+    if (!walks.count) continue;
+    output << name(ListWalk(kind)) << ": " << walks.count << " walks, " << walks.nodes
+           << " nodes, longest " << walks.longest << ", lengths";
+    for (std::size_t bucket = 0; bucket < buckets; ++bucket) {
+      if (!walks.lengths[bucket]) continue;
+      output << " ";
+      if (bucket < 2)
+        output << bucket;
+      else
+        output << (uint64_t(1) << (bucket - 1)) << "-" << ((uint64_t(1) << bucket) - 1);
+      output << ":" << walks.lengths[bucket];
+    }
+    output << "\n";
+  }
+}
+
+inline const char* ListStatistics::name(const ListWalk kind) {
+  static const char* const names[walkKinds] = {"access",   "insert", "remove",
+                                               "unappend", "splice", "split"};
+  return names[std::size_t(kind)];
+}
+
+// The number of significant bits, capped at the last bucket.
+inline const std::size_t ListStatistics::bucketOf(const std::size_t nodes) {
+  if (!nodes) return 0;
+  const std::size_t bits = 64 - __builtin_clzll(nodes);
+  return bits < buckets ? bits : buckets - 1;
+}
+
+#endif
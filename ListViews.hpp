@@ -0,0 +1,218 @@
+#ifndef LISTVIEWS_HPP
+#define LISTVIEWS_HPP
+
+#include <stddef.h>
+#include <coroutine>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+
+// Lazy views over the list family (C++20). Every list's iterators model the
+// standard iterator concepts, so the standard adaptors apply directly and
+// compose without building intermediate lists:
+//   list | std::views::filter(odd) | std::views::transform(square) | std::views::take(3)
+// Elements are pulled one at a time through the whole pipeline as it is
+// iterated. This header adds what C++20 lacks: zip, which pairs two lists
+// element by element, and ListGenerator, a coroutine whose co_yield hands an
+// element to the consumer without copying it.
+
+// Coroutine returning the values it co_yields as a lazy input range. A
+// reference `Reference` points at the yielded object, which stays alive while
+// the coroutine is suspended, and a value type copies it out. The range can
+// be iterated once, and an exception thrown by the coroutine is rethrown
+// where the range is advanced.
+template <typename Reference>
+class ListGenerator : public std::ranges::view_interface<ListGenerator<Reference>> {
+  using Yielded = std::conditional_t<std::is_reference_v<Reference>, Reference, const Reference&>;
+
+ public:
+  class promise_type {
+   public:
+    ListGenerator get_return_object() {
+      return ListGenerator(std::coroutine_handle<promise_type>::from_promise(*this));
+    }
+    std::suspend_always initial_suspend() const noexcept {
+      return {};
+    }
+    std::suspend_always final_suspend() const noexcept {
+      return {};
+    }
+    std::suspend_always yield_value(Yielded value) noexcept {
+      this->value = std::addressof(value);
+      return {};
+    }
+    void return_void() const {}
+    void unhandled_exception() {
+      this->exception = std::current_exception();
+    }
+    // Disallows co_await, which would suspend without yielding a value.
+    template <typename U>
+    std::suspend_never await_transform(U&&) = delete;
+
+   private:
+    friend class ListGenerator;
+
+    std::add_pointer_t<Yielded> value = nullptr;
+    std::exception_ptr exception;
+  };
+
+  class iterator {
+   public:
+    using value_type = std::remove_cvref_t<Reference>;
+    using difference_type = std::ptrdiff_t;
+
+    iterator() = default;
+    iterator& operator++() {
+      this->coroutine.resume();
+      if (this->coroutine.promise().exception)
+        std::rethrow_exception(std::exchange(this->coroutine.promise().exception, nullptr));
+      return *this;
+    }
+    void operator++(int) {
+      this->operator++();
+    }
+    Reference operator*() const {
+      return static_cast<Reference>(*this->coroutine.promise().value);
+    }
+    friend bool operator==(const iterator& self, std::default_sentinel_t) {
+      return !self.coroutine || self.coroutine.done();
+    }
+
+   private:
+    friend class ListGenerator;
+
+    explicit iterator(std::coroutine_handle<promise_type> coroutine) : coroutine(coroutine) {}
+
+    std::coroutine_handle<promise_type> coroutine;
+  };
+
+  // Constructors
+  ListGenerator(ListGenerator&& other) noexcept
+      : coroutine(std::exchange(other.coroutine, nullptr)) {}
+  ListGenerator& operator=(ListGenerator&& other) noexcept {
+    if (this != &other) {
+      if (this->coroutine) this->coroutine.destroy();
+      this->coroutine = std::exchange(other.coroutine, nullptr);
+    }
+    return *this;
+  }
+  ~ListGenerator() {
+    if (this->coroutine) this->coroutine.destroy();
+  }
+
+  // Iterators
+  // Runs the coroutine up to its first co_yield.
+  iterator begin() {
+    iterator first(this->coroutine);
+    ++first;
+    return first;
+  }
+  std::default_sentinel_t end() const {
+    return std::default_sentinel;
+  }
+
+ private:
+  explicit ListGenerator(std::coroutine_handle<promise_type> coroutine) : coroutine(coroutine) {}
+
+  std::coroutine_handle<promise_type> coroutine;
+};
+
+// Yields the elements of `list` in order, by reference, following the list's
+// own links; nothing is copied and the list must outlive the generator.
+template <std::ranges::input_range List>
+ListGenerator<std::ranges::range_reference_t<List&>> generate(List& list) {
+  for (auto&& element : list) co_yield element;
+}
+
+// Pairs the elements of two ranges position by position and stops at the end
+// of the shorter one. Holds the ranges by address, like std::ranges::ref_view.
+template <std::ranges::forward_range First, std::ranges::forward_range Second>
+class ZipView : public std::ranges::view_interface<ZipView<First, Second>> {
+  using FirstIterator = std::ranges::iterator_t<First>;
+  using SecondIterator = std::ranges::iterator_t<Second>;
+
+ public:
+  class sentinel;
+
+  class iterator {
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type =
+        std::pair<std::ranges::range_value_t<First>, std::ranges::range_value_t<Second>>;
+    using difference_type = std::ptrdiff_t;
+    using reference =
+        std::pair<std::ranges::range_reference_t<First>, std::ranges::range_reference_t<Second>>;
+
+    iterator() = default;
+    iterator(FirstIterator first, SecondIterator second) : first(first), second(second) {}
+
+    iterator& operator++() {
+      ++this->first;
+      ++this->second;
+      return *this;
+    }
+    iterator operator++(int) {
+      iterator previous = *this;
+      this->operator++();
+      return previous;
+    }
+    reference operator*() const {
+      return reference(*this->first, *this->second);
+    }
+    friend bool operator==(const iterator& self, const iterator& other) {
+      return self.first == other.first && self.second == other.second;
+    }
+
+   private:
+    friend class sentinel;
+
+    FirstIterator first;
+    SecondIterator second;
+  };
+
+  class sentinel {
+   public:
+    sentinel() = default;
+    sentinel(std::ranges::sentinel_t<First> first, std::ranges::sentinel_t<Second> second)
+        : first(first), second(second) {}
+
+    friend bool operator==(const iterator& position, const sentinel& self) {
+      return self.reached(position);
+    }
+
+   private:
+    bool reached(const iterator& position) const {
+      return position.first == this->first || position.second == this->second;
+    }
+
+    std::ranges::sentinel_t<First> first;
+    std::ranges::sentinel_t<Second> second;
+  };
+
+  // Constructors
+  ZipView() : first(nullptr), second(nullptr) {}
+  ZipView(First& first, Second& second)
+      : first(std::addressof(first)), second(std::addressof(second)) {}
+
+  // Iterators
+  iterator begin() const {
+    return iterator(std::ranges::begin(*this->first), std::ranges::begin(*this->second));
+  }
+  sentinel end() const {
+    return sentinel(std::ranges::end(*this->first), std::ranges::end(*this->second));
+  }
+
+ private:
+  First* first;
+  Second* second;
+};
+
+template <typename First, typename Second>
+ZipView<First, Second> zip(First& first, Second& second) {
+  return ZipView<First, Second>(first, second);
+}
+
+#endif
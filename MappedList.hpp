@@ -0,0 +1,193 @@
+#ifndef MAPPEDLIST_HPP
+#define MAPPEDLIST_HPP
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stddef.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <cstring>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include "BlockSearch.hpp"
+#include "ListFile.hpp"
+#include "ListIndexOutOfBounds.hpp"
+
+// Read-only view of a list file saved by one of the lists, mapped into memory
+// instead of read. Opening costs the same however long the list is: pages are
+// loaded as they are touched, and views of the same file share them. The file
+// must not be modified while a view of it is open. Needs a trivially copyable
+// T, whose elements the file stores contiguously.
+template <typename T>
+class MappedList {
+  static_assert(std::is_trivially_copyable<T>::value,
+                "MappedList needs a trivially copyable element type");
+  static_assert(alignof(T) <= sizeof(ListFileHeader),
+                "MappedList elements must fit the alignment of the payload");
+
+ public:
+  using value_type = T;
+  using size_type = std::size_t;
+  using const_reference = const T&;
+  using const_iterator = const T*;
+
+  // Constructors
+  explicit MappedList(const std::string&);
+  MappedList(const MappedList&) = delete;
+  MappedList(MappedList&&) noexcept;
+  MappedList& operator=(const MappedList&) = delete;
+  MappedList& operator=(MappedList&&) noexcept;
+  ~MappedList();
+
+  // Getters
+  const T& getHead() const;
+  const T& getTail() const;
+  const bool isEmpty() const;
+  const bool contains(const T&) const;
+  const std::size_t size() const;
+
+  // Iterators
+  const_iterator begin() const;
+  const_iterator end() const;
+
+  // Operators
+  const T& operator[](const std::size_t) const;
+
+  // Friend Operator
+  friend std::ostream& operator<<(std::ostream& output, const MappedList& self) {
+    output << "[";
+    for (std::size_t i = 0; i < self.length; ++i) {
+      if (i) output << "->";
+      output << self.values[i];
+    }
+    output << "]";
+    return output;
+  }
+
+ private:
+  void unmap();
+
+  void* mapping;
+  std::size_t mappedBytes;
+  const T* values;
+  std::size_t length;
+};
+
+template <typename T>
+MappedList<T>::MappedList(const std::string& path)
+    : mapping(nullptr), mappedBytes(0), values(nullptr), length(0) {
+  const int descriptor = open(path.c_str(), O_RDONLY);
+  if (descriptor < 0)
+    throw std::runtime_error("cannot open " + path + ": " + std::strerror(errno));
+  struct stat status;
+  if (fstat(descriptor, &status) != 0 || std::size_t(status.st_size) < sizeof(ListFileHeader)) {
+    close(descriptor);
+    throw std::runtime_error(path + " is not a list file");
+  }
+  this->mappedBytes = status.st_size;
+  this->mapping = mmap(nullptr, this->mappedBytes, PROT_READ, MAP_SHARED, descriptor, 0);
+  close(descriptor);
+  if (this->mapping == MAP_FAILED) {
+    this->mapping = nullptr;
+    throw std::runtime_error("cannot map " + path + ": " + std::strerror(errno));
+  }
+  const ListFileHeader& header = *static_cast<const ListFileHeader*>(this->mapping);
+  try {
+    checkListFileHeader<T>(header, path);
+    if (header.length > (this->mappedBytes - sizeof(header)) / sizeof(T))
+      throw std::runtime_error(path + " is truncated");
+  } catch (...) {
+    this->unmap();
+    throw;
+  }
+  this->values =
+      reinterpret_cast<const T*>(static_cast<const char*>(this->mapping) + sizeof(header));
+  this->length = header.length;
+}
+
+template <typename T>
+MappedList<T>::MappedList(MappedList&& other) noexcept
+    : mapping(other.mapping),
+      mappedBytes(other.mappedBytes),
+      values(other.values),
+      length(other.length) {
+  other.mapping = nullptr;
+  other.mappedBytes = 0;
+  other.values = nullptr;
+  other.length = 0;
+}
+
+template <typename T>
+MappedList<T>& MappedList<T>::operator=(MappedList&& other) noexcept {
+  if (this != &other) {
+    this->unmap();
+    std::swap(this->mapping, other.mapping);
+    std::swap(this->mappedBytes, other.mappedBytes);
+    std::swap(this->values, other.values);
+    std::swap(this->length, other.length);
+  }
+  return *this;
+}
+
+template <typename T>
+MappedList<T>::~MappedList() {
+  this->unmap();
+}
+
+template <typename T>
+const T& MappedList<T>::getHead() const {
+  if (this->isEmpty()) throw ListIndexOutOfBounds();
+  return this->values[0];
+}
+
+template <typename T>
+const T& MappedList<T>::getTail() const {
+  if (this->isEmpty()) throw ListIndexOutOfBounds();
+  return this->values[this->length - 1];
+}
+
+template <typename T>
+const bool MappedList<T>::isEmpty() const {
+  return this->length == 0;
+}
+
+template <typename T>
+const bool MappedList<T>::contains(const T& data) const {
+  return BlockSearch<T>::find(this->values, this->length, data) < this->length;
+}
+
+template <typename T>
+const std::size_t MappedList<T>::size() const {
+  return this->length;
+}
+
+template <typename T>
+typename MappedList<T>::const_iterator MappedList<T>::begin() const {
+  return this->values;
+}
+
+template <typename T>
+typename MappedList<T>::const_iterator MappedList<T>::end() const {
+  return this->values + this->length;
+}
+
+template <typename T>
+const T& MappedList<T>::operator[](const std::size_t index) const {
+  if (index >= this->length) throw ListIndexOutOfBounds(index, this->length);
+  return this->values[index];
+}
+
+template <typename T>
+void MappedList<T>::unmap() {
+  if (this->mapping) munmap(this->mapping, this->mappedBytes);
+  this->mapping = nullptr;
+  this->mappedBytes = 0;
+  this->values = nullptr;
+  this->length = 0;
+}
+
+#endif
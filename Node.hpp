@@ -1,11 +1,17 @@
 #ifndef NODE_HPP
 #define NODE_HPP
 
+#include <ostream>
+#include <utility>
+
 template <typename T>
 struct Node {
   T data;
   Node* next;
   Node(const T&);
+  Node(T&&);
+  template <typename... Args>
+  Node(std::in_place_t, Args&&...);
 
   friend std::ostream& operator<<(std::ostream& output, const Node& self) {
     output << "Data: " << self.data << "Next: " << self.next;
@@ -16,4 +22,12 @@ struct Node {
 template <typename T>
 Node<T>::Node(const T& data) : data(data), next(nullptr) {}
 
+template <typename T>
+Node<T>::Node(T&& data) : data(std::move(data)), next(nullptr) {}
+
+template <typename T>
+template <typename... Args>
+Node<T>::Node(std::in_place_t, Args&&... args)
+    : data(std::forward<Args>(args)...), next(nullptr) {}
+
 #endif
\ No newline at end of file
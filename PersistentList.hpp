@@ -0,0 +1,331 @@
+#ifndef PERSISTENTLIST_HPP
+#define PERSISTENTLIST_HPP
+
+#include <stddef.h>
+#include <atomic>
+#include <initializer_list>
+#include <ostream>
+#include <utility>
+#include <vector>
+#include "ListIndexOutOfBounds.hpp"
+#include "PersistentListIterator.hpp"
+#include "PersistentNode.hpp"
+
+// Immutable singly linked list whose versions share nodes. Operations return
+// a new list and leave the one they are called on untouched:
+// - prepend and unprepend are O(1) and share the whole rest of the list;
+// - insert, remove and append copy the nodes before the position and share
+//   everything after it;
+// - copying a list is O(1), so a snapshot is simply a copy.
+// Nodes never change and their reference counts are atomic, so lists sharing
+// nodes can be read, copied and destroyed on different threads without
+// locking. A single list object that is reassigned while another thread reads
+// it still needs synchronization, like any other object.
+template <typename T>
+class PersistentList {
+ public:
+  using value_type = T;
+  using size_type = std::size_t;
+  using const_reference = const T&;
+  using const_iterator = PersistentListIterator<T>;
+  using iterator = const_iterator;
+
+  // Constructors
+  PersistentList();
+  PersistentList(const T&);
+  PersistentList(const std::initializer_list<T>);
+  PersistentList(const PersistentList&) noexcept;
+  PersistentList(PersistentList&&) noexcept;
+  PersistentList& operator=(const PersistentList&) noexcept;
+  PersistentList& operator=(PersistentList&&) noexcept;
+  ~PersistentList();
+
+  // Getters
+  const T& getHead() const;
+  const T& getTail() const;
+  const bool isEmpty() const;
+  const bool contains(const T&) const;
+  const std::size_t size() const;
+
+  // Versions
+  PersistentList<T> prepend(const T&) const;
+  PersistentList<T> prepend(T&&) const;
+  PersistentList<T> unprepend() const;
+  PersistentList<T> append(const T&) const;
+  PersistentList<T> insert(const T&, const std::size_t) const;
+  PersistentList<T> remove(const std::size_t) const;
+  PersistentList<T> drop(const std::size_t) const;
+
+  // Iterators
+  const_iterator begin() const;
+  const_iterator end() const;
+  const_iterator cbegin() const;
+  const_iterator cend() const;
+
+  // Operators
+  const bool operator==(const PersistentList&) const;
+  const bool operator!=(const PersistentList&) const;
+  const T& operator[](const std::size_t) const;
+
+  // Friend Operator
+  friend std::ostream& operator<<(std::ostream& output, const PersistentList& self) {
+    output << "[";
+    for (const PersistentNode<T>* current = self.head; current; current = current->next) {
+      output << current->data;
+      if (current->next) output << "->";
+    }
+    output << "]";
+    return output;
+  }
+
+ private:
+  PersistentList(PersistentNode<T>*, const PersistentNode<T>*, const std::size_t);
+
+  PersistentList<T> copyPrefix(const std::size_t, PersistentNode<T>*, const PersistentNode<T>*,
+                               const std::size_t) const;
+  PersistentNode<T>* nodeAt(const std::size_t) const;
+  static PersistentNode<T>* retain(PersistentNode<T>*);
+  static void release(PersistentNode<T>*);
+
+  // Each list holds one reference to its head.
+  PersistentNode<T>* head;
+  const PersistentNode<T>* last;
+  std::size_t length;
+};
+
+template <typename T>
+PersistentList<T>::PersistentList() : head(nullptr), last(nullptr), length(0) {}
+
+template <typename T>
+PersistentList<T>::PersistentList(const T& data)
+    : head(new PersistentNode<T>(data, nullptr)), last(head), length(1) {}
+
+template <typename T>
+PersistentList<T>::PersistentList(const std::initializer_list<T> args) : PersistentList() {
+  for (auto data = args.end(); data != args.begin();) *this = this->prepend(*--data);
+}
+
+template <typename T>
+PersistentList<T>::PersistentList(const PersistentList& other) noexcept
+    : head(retain(other.head)), last(other.last), length(other.length) {}
+
+template <typename T>
+PersistentList<T>::PersistentList(PersistentList&& other) noexcept
+    : head(other.head), last(other.last), length(other.length) {
+  other.head = nullptr;
+  other.last = nullptr;
+  other.length = 0;
+}
+
+template <typename T>
+PersistentList<T>& PersistentList<T>::operator=(const PersistentList& other) noexcept {
+  retain(other.head);
+  release(this->head);
+  this->head = other.head;
+  this->last = other.last;
+  this->length = other.length;
+  return *this;
+}
+
+template <typename T>
+PersistentList<T>& PersistentList<T>::operator=(PersistentList&& other) noexcept {
+  if (this != &other) {
+    release(this->head);
+    this->head = other.head;
+    this->last = other.last;
+    this->length = other.length;
+    other.head = nullptr;
+    other.last = nullptr;
+    other.length = 0;
+  }
+  return *this;
+}
+
+template <typename T>
+PersistentList<T>::~PersistentList() {
+  release(this->head);
+}
+
+template <typename T>
+const T& PersistentList<T>::getHead() const {
+  if (this->isEmpty()) throw ListIndexOutOfBounds();
+  return this->head->data;
+}
+
+template <typename T>
+const T& PersistentList<T>::getTail() const {
+  if (this->isEmpty()) throw ListIndexOutOfBounds();
+  return this->last->data;
+}
+
+template <typename T>
+const bool PersistentList<T>::isEmpty() const {
+  return this->length == 0;
+}
+
+template <typename T>
+const bool PersistentList<T>::contains(const T& data) const {
+  for (const PersistentNode<T>* current = this->head; current; current = current->next)
+    if (current->data == data) return true;
+  return false;
+}
+
+template <typename T>
+const std::size_t PersistentList<T>::size() const {
+  return this->length;
+}
+
+template <typename T>
+PersistentList<T> PersistentList<T>::prepend(const T& data) const {
+  PersistentNode<T>* front = new PersistentNode<T>(data, this->head);
+  retain(this->head);
+  return PersistentList<T>(front, this->last ? this->last : front, this->length + 1);
+}
+
+template <typename T>
+PersistentList<T> PersistentList<T>::prepend(T&& data) const {
+  PersistentNode<T>* front = new PersistentNode<T>(std::move(data), this->head);
+  retain(this->head);
+  return PersistentList<T>(front, this->last ? this->last : front, this->length + 1);
+}
+
+template <typename T>
+PersistentList<T> PersistentList<T>::unprepend() const {
+  if (this->isEmpty()) throw ListIndexOutOfBounds(0, 0);
+  return PersistentList<T>(retain(this->head->next), this->length > 1 ? this->last : nullptr,
+                           this->length - 1);
+}
+
+template <typename T>
+PersistentList<T> PersistentList<T>::append(const T& data) const {
+  return this->insert(data, this->length);
+}
+
+template <typename T>
+PersistentList<T> PersistentList<T>::insert(const T& data, const std::size_t index) const {
+  if (index > this->length) throw ListIndexOutOfBounds(index, this->length);
+  if (index == 0) return this->prepend(data);
+  PersistentNode<T>* rest = index < this->length ? this->nodeAt(index) : nullptr;
+  PersistentNode<T>* inserted = new PersistentNode<T>(data, rest);
+  retain(rest);
+  return this->copyPrefix(index, inserted, rest ? this->last : inserted, this->length + 1);
+}
+
+template <typename T>
+PersistentList<T> PersistentList<T>::remove(const std::size_t index) const {
+  if (index >= this->length) throw ListIndexOutOfBounds(index, this->length);
+  if (index == 0) return this->unprepend();
+  PersistentNode<T>* rest = this->nodeAt(index)->next;
+  return this->copyPrefix(index, retain(rest), rest ? this->last : nullptr, this->length - 1);
+}
+
+// The list without its first `count` elements, sharing all of its nodes.
+template <typename T>
+PersistentList<T> PersistentList<T>::drop(const std::size_t count) const {
+  if (count > this->length) throw ListIndexOutOfBounds(count, this->length + 1);
+  if (count == this->length) return PersistentList<T>();
+  return PersistentList<T>(retain(this->nodeAt(count)), this->last, this->length - count);
+}
+
+template <typename T>
+typename PersistentList<T>::const_iterator PersistentList<T>::begin() const {
+  return const_iterator(this->head);
+}
+
+template <typename T>
+typename PersistentList<T>::const_iterator PersistentList<T>::end() const {
+  return const_iterator(nullptr);
+}
+
+template <typename T>
+typename PersistentList<T>::const_iterator PersistentList<T>::cbegin() const {
+  return this->begin();
+}
+
+template <typename T>
+typename PersistentList<T>::const_iterator PersistentList<T>::cend() const {
+  return this->end();
+}
+
+// Stops as soon as both lists reach a shared node, since everything after it
+// is the same.
+template <typename T>
+const bool PersistentList<T>::operator==(const PersistentList& other) const {
+  if (this->length != other.length) return false;
+  const PersistentNode<T>* otherCurrent = other.head;
+  for (const PersistentNode<T>* current = this->head; current != otherCurrent;
+       current = current->next) {
+    if (current->data != otherCurrent->data) return false;
+    otherCurrent = otherCurrent->next;
+  }
+  return true;
+}
+
+template <typename T>
+const bool PersistentList<T>::operator!=(const PersistentList& other) const {
+  return !this->operator==(other);
+}
+
+template <typename T>
+const T& PersistentList<T>::operator[](const std::size_t index) const {
+  if (index >= this->length) throw ListIndexOutOfBounds(index, this->length);
+  return this->nodeAt(index)->data;
+}
+
+// Adopts the reference to `head` the caller holds.
+template <typename T>
+PersistentList<T>::PersistentList(PersistentNode<T>* head, const PersistentNode<T>* last,
+                                  const std::size_t length)
+    : head(head), last(last), length(length) {}
+
+// Builds a version of `length` elements made of copies of the first `count`
+// elements followed by `rest`, adopting the caller's reference to `rest`.
+// `last` is the last node of `rest`, or null when the last copy ends the list.
+template <typename T>
+PersistentList<T> PersistentList<T>::copyPrefix(const std::size_t count, PersistentNode<T>* rest,
+                                                const PersistentNode<T>* last,
+                                                const std::size_t length) const {
+  PersistentNode<T>* front = rest;
+  try {
+    std::vector<const PersistentNode<T>*> prefix;
+    prefix.reserve(count);
+    for (const PersistentNode<T>* current = this->head; prefix.size() < count;
+         current = current->next)
+      prefix.push_back(current);
+    while (!prefix.empty()) {
+      front = new PersistentNode<T>(prefix.back()->data, front);
+      prefix.pop_back();
+      if (!last) last = front;
+    }
+  } catch (...) {
+    release(front);
+    throw;
+  }
+  return PersistentList<T>(front, last, length);
+}
+
+template <typename T>
+PersistentNode<T>* PersistentList<T>::nodeAt(const std::size_t index) const {
+  PersistentNode<T>* current = this->head;
+  for (std::size_t position = 0; position < index; ++position) current = current->next;
+  return current;
+}
+
+template <typename T>
+PersistentNode<T>* PersistentList<T>::retain(PersistentNode<T>* node) {
+  if (node) node->references.fetch_add(1, std::memory_order_relaxed);
+  return node;
+}
+
+// Drops one reference to `node` and deletes the nodes no longer reached,
+// iteratively so that long chains do not exhaust the stack.
+template <typename T>
+void PersistentList<T>::release(PersistentNode<T>* node) {
+  while (node && node->references.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+    PersistentNode<T>* next = node->next;
+    delete node;
+    node = next;
+  }
+}
+
+#endif
@@ -0,0 +1,49 @@
+#ifndef PERSISTENTLISTITERATOR_HPP
+#define PERSISTENTLISTITERATOR_HPP
+
+#include <stddef.h>
+#include <iterator>
+#include "PersistentNode.hpp"
+
+// Forward iterator over a PersistentList. Elements are immutable, so it only
+// hands out const references. It stays valid as long as some list still
+// reaches its node.
+template <typename T>
+class PersistentListIterator {
+ public:
+  using iterator_category = std::forward_iterator_tag;
+  using value_type = T;
+  using difference_type = std::ptrdiff_t;
+  using pointer = const T*;
+  using reference = const T&;
+
+  PersistentListIterator() : current(nullptr) {}
+  explicit PersistentListIterator(const PersistentNode<T>* start) : current(start) {}
+
+  PersistentListIterator& operator++() {
+    this->current = this->current->next;
+    return *this;
+  }
+  PersistentListIterator operator++(int) {
+    PersistentListIterator previous = *this;
+    this->current = this->current->next;
+    return previous;
+  }
+  reference operator*() const {
+    return this->current->data;
+  }
+  pointer operator->() const {
+    return &this->current->data;
+  }
+  const bool operator==(const PersistentListIterator& other) const {
+    return this->current == other.current;
+  }
+  const bool operator!=(const PersistentListIterator& other) const {
+    return this->current != other.current;
+  }
+
+ private:
+  const PersistentNode<T>* current;
+};
+
+#endif
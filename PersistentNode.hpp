@@ -0,0 +1,36 @@
+#ifndef PERSISTENTNODE_HPP
+#define PERSISTENTNODE_HPP
+
+#include <stddef.h>
+#include <atomic>
+#include <ostream>
+#include <utility>
+
+// Immutable node shared by every PersistentList version that reaches it.
+// `references` counts the lists and nodes pointing at it; the last release
+// deletes it.
+template <typename T>
+struct PersistentNode {
+  const T data;
+  PersistentNode* const next;
+  mutable std::atomic<std::size_t> references;
+
+  PersistentNode(const T&, PersistentNode*);
+  PersistentNode(T&&, PersistentNode*);
+
+  friend std::ostream& operator<<(std::ostream& output, const PersistentNode& self) {
+    output << "Data: " << self.data << "Next: " << self.next
+           << "References: " << self.references.load();
+    return output;
+  }
+};
+
+template <typename T>
+PersistentNode<T>::PersistentNode(const T& data, PersistentNode* next)
+    : data(data), next(next), references(1) {}
+
+template <typename T>
+PersistentNode<T>::PersistentNode(T&& data, PersistentNode* next)
+    : data(std::move(data)), next(next), references(1) {}
+
+#endif
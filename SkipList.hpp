@@ -0,0 +1,406 @@
+#ifndef SKIPLIST_HPP
+#define SKIPLIST_HPP
+
+#include <stddef.h>
+#include <stdint.h>
+#include <initializer_list>
+#include <ostream>
+#include <utility>
+#include <vector>
+#include "ListIndexOutOfBounds.hpp"
+#include "SkipListIterator.hpp"
+#include "SkipNode.hpp"
+
+// Positional skip list: elements stay in insertion order like LinkedList, and
+// every forward link records how many positions it skips, so operator[],
+// insert and remove(index) descend the levels in expected O(log n) instead of
+// walking the chain. Level 0 is an ordinary singly linked list.
+template <typename T>
+class SkipList {
+ public:
+  static constexpr std::size_t maxHeight = 32;
+
+  // Constructors
+  SkipList();
+  SkipList(const T&);
+  SkipList(const std::initializer_list<T>);
+  SkipList(const SkipList&);
+  SkipList(SkipList&&) noexcept;
+  SkipList& operator=(const SkipList&);
+  SkipList& operator=(SkipList&&) noexcept;
+  ~SkipList();
+
+  // Getters
+  const T& getHead() const;
+  const T& getTail() const;
+  const bool isEmpty() const;
+  const bool contains(const T&) const;
+  const std::size_t size() const;
+
+  // Mutators
+  SkipList<T>& append(const T&);
+  SkipList<T>& append(T&&);
+  SkipList<T>& prepend(const T&);
+  SkipList<T>& prepend(T&&);
+  SkipList<T>& insert(const T&, const std::size_t);
+  SkipList<T>& insert(T&&, const std::size_t);
+  template <typename... Args>
+  SkipList<T>& emplaceBack(Args&&...);
+  template <typename... Args>
+  SkipList<T>& emplaceFront(Args&&...);
+  template <typename... Args>
+  SkipList<T>& emplace(const std::size_t, Args&&...);
+  T unappend();
+  T unprepend();
+  T remove(const std::size_t);
+  SkipList<T>& remove(const T&, const std::size_t);
+  void clear();
+
+  // Iterators
+  SkipListIterator<T> begin() const;
+  SkipListIterator<T> end() const;
+
+  // Operators
+  const bool operator==(const SkipList&) const;
+  const bool operator!=(const SkipList&) const;
+  const T& operator[](const std::size_t) const;
+  T& operator[](const std::size_t);
+
+  // Friend Operator
+  friend std::ostream& operator<<(std::ostream& output, const SkipList& self) {
+    SkipNode<T>* current = self.first();
+    output << "[";
+    if (current) {
+      while (current->links()[0].next) {
+        output << current->data << "->";
+        current = current->links()[0].next;
+      }
+      output << current->data;
+    }
+    output << "]";
+    return output;
+  }
+
+ private:
+  SkipNode<T>* first() const;
+  SkipLink<T>* linksOf(SkipNode<T>*);
+  const SkipLink<T>* linksOf(const SkipNode<T>*) const;
+  SkipNode<T>* nodeAt(const std::size_t) const;
+  std::size_t randomHeight();
+
+  // Links of the sentinel before the first element (position 0; element i
+  // sits at position i + 1). One entry per level in use, and none in a list
+  // that was just created, cleared or moved from, so those never allocate.
+  std::vector<SkipLink<T>> head;
+  std::size_t length;
+  uint64_t seed;
+};
+
+template <typename T>
+SkipList<T>::SkipList() : length(0), seed(0x9E3779B97F4A7C15ull) {}
+
+template <typename T>
+SkipList<T>::SkipList(const T& data) : SkipList() {
+  this->append(data);
+}
+
+template <typename T>
+SkipList<T>::SkipList(const std::initializer_list<T> args) : SkipList() {
+  for (const T& data : args) this->append(data);
+}
+
+template <typename T>
+SkipList<T>::SkipList(const SkipList& other) : SkipList() {
+  for (const T& data : other) this->append(data);
+}
+
+template <typename T>
+SkipList<T>::SkipList(SkipList&& other) noexcept
+    : head(std::move(other.head)), length(other.length), seed(other.seed) {
+  other.head.clear();
+  other.length = 0;
+}
+
+template <typename T>
+SkipList<T>& SkipList<T>::operator=(const SkipList& other) {
+  if (this != &other) {
+    this->clear();
+    for (const T& data : other) this->append(data);
+  }
+  return *this;
+}
+
+template <typename T>
+SkipList<T>& SkipList<T>::operator=(SkipList&& other) noexcept {
+  if (this != &other) {
+    this->clear();
+    std::swap(this->head, other.head);
+    std::swap(this->length, other.length);
+  }
+  return *this;
+}
+
+template <typename T>
+SkipList<T>::~SkipList() {
+  this->clear();
+}
+
+template <typename T>
+const T& SkipList<T>::getHead() const {
+  if (this->isEmpty()) throw ListIndexOutOfBounds();
+  return this->first()->data;
+}
+
+template <typename T>
+const T& SkipList<T>::getTail() const {
+  if (this->isEmpty()) throw ListIndexOutOfBounds();
+  return this->nodeAt(this->length - 1)->data;
+}
+
+template <typename T>
+const bool SkipList<T>::isEmpty() const {
+  return this->length == 0;
+}
+
+template <typename T>
+const bool SkipList<T>::contains(const T& data) const {
+  for (SkipNode<T>* current = this->first(); current; current = current->links()[0].next)
+    if (current->data == data) return true;
+  return false;
+}
+
+template <typename T>
+const std::size_t SkipList<T>::size() const {
+  return this->length;
+}
+
+template <typename T>
+SkipList<T>& SkipList<T>::append(const T& data) {
+  return this->emplace(this->length, data);
+}
+
+template <typename T>
+SkipList<T>& SkipList<T>::append(T&& data) {
+  return this->emplace(this->length, std::move(data));
+}
+
+template <typename T>
+SkipList<T>& SkipList<T>::prepend(const T& data) {
+  return this->emplace(0, data);
+}
+
+template <typename T>
+SkipList<T>& SkipList<T>::prepend(T&& data) {
+  return this->emplace(0, std::move(data));
+}
+
+template <typename T>
+SkipList<T>& SkipList<T>::insert(const T& data, const std::size_t index) {
+  return this->emplace(index, data);
+}
+
+template <typename T>
+SkipList<T>& SkipList<T>::insert(T&& data, const std::size_t index) {
+  return this->emplace(index, std::move(data));
+}
+
+template <typename T>
+template <typename... Args>
+SkipList<T>& SkipList<T>::emplaceBack(Args&&... args) {
+  return this->emplace(this->length, std::forward<Args>(args)...);
+}
+
+template <typename T>
+template <typename... Args>
+SkipList<T>& SkipList<T>::emplaceFront(Args&&... args) {
+  return this->emplace(0, std::forward<Args>(args)...);
+}
+
+// Levels added for a tall node start out empty, so an empty head gains its
+// bottom level here.
+template <typename T>
+template <typename... Args>
+SkipList<T>& SkipList<T>::emplace(const std::size_t index, Args&&... args) {
+  if (index > this->length) throw ListIndexOutOfBounds(index, this->length);
+  const std::size_t height = this->randomHeight();
+  while (this->head.size() < height)
+    this->head.push_back(SkipLink<T>{nullptr, this->length + 1});
+  SkipNode<T>* toAdd = SkipNode<T>::create(height, std::forward<Args>(args)...);
+  // Find the last node before the new position on every level, splicing the
+  // new node in below its height and widening the links that jump over it.
+  SkipNode<T>* current = nullptr;
+  std::size_t position = 0;
+  for (std::size_t level = this->head.size(); level-- > 0;) {
+    SkipLink<T>* links = this->linksOf(current);
+    while (links[level].next && position + links[level].width <= index) {
+      position += links[level].width;
+      current = links[level].next;
+      links = current->links();
+    }
+    if (level < height) {
+      toAdd->links()[level] =
+          SkipLink<T>{links[level].next, position + links[level].width - index};
+      links[level] = SkipLink<T>{toAdd, index + 1 - position};
+    } else {
+      ++links[level].width;
+    }
+  }
+  ++this->length;
+  return *this;
+}
+
+template <typename T>
+T SkipList<T>::unappend() {
+  if (this->isEmpty()) throw ListIndexOutOfBounds(0, 0);
+  return this->remove(this->length - 1);
+}
+
+template <typename T>
+T SkipList<T>::unprepend() {
+  if (this->isEmpty()) throw ListIndexOutOfBounds(0, 0);
+  return this->remove(0);
+}
+
+template <typename T>
+T SkipList<T>::remove(const std::size_t index) {
+  if (index >= this->length) throw ListIndexOutOfBounds(index, this->length);
+  SkipNode<T>* out = nullptr;
+  SkipNode<T>* current = nullptr;
+  std::size_t position = 0;
+  for (std::size_t level = this->head.size(); level-- > 0;) {
+    SkipLink<T>* links = this->linksOf(current);
+    while (links[level].next && position + links[level].width <= index) {
+      position += links[level].width;
+      current = links[level].next;
+      links = current->links();
+    }
+    if (links[level].next && position + links[level].width == index + 1) {
+      out = links[level].next;
+      links[level].width += out->links()[level].width - 1;
+      links[level].next = out->links()[level].next;
+    } else {
+      --links[level].width;
+    }
+  }
+  while (this->head.size() > 1 && !this->head.back().next) this->head.pop_back();
+  --this->length;
+  T data = std::move(out->data);
+  SkipNode<T>::destroy(out);
+  return data;
+}
+
+template <typename T>
+SkipList<T>& SkipList<T>::remove(const T& data, const std::size_t num) {
+  std::size_t numRemoved = 0;
+  std::size_t index = 0;
+  SkipNode<T>* current = this->first();
+  while (numRemoved < num && current) {
+    SkipNode<T>* next = current->links()[0].next;
+    if (current->data == data) {
+      this->remove(index);
+      ++numRemoved;
+    } else {
+      ++index;
+    }
+    current = next;
+  }
+  return *this;
+}
+
+template <typename T>
+void SkipList<T>::clear() {
+  SkipNode<T>* current = this->first();
+  while (current) {
+    SkipNode<T>* next = current->links()[0].next;
+    SkipNode<T>::destroy(current);
+    current = next;
+  }
+  this->head.clear();
+  this->length = 0;
+}
+
+template <typename T>
+SkipListIterator<T> SkipList<T>::begin() const {
+  return SkipListIterator<T>(this->first());
+}
+
+template <typename T>
+SkipListIterator<T> SkipList<T>::end() const {
+  return SkipListIterator<T>(nullptr);
+}
+
+template <typename T>
+const bool SkipList<T>::operator==(const SkipList& other) const {
+  if (this == &other) return true;
+  if (this->length != other.length) return false;
+  SkipNode<T>* thisCurrent = this->first();
+  SkipNode<T>* otherCurrent = other.first();
+  while (thisCurrent) {
+    if (thisCurrent->data != otherCurrent->data) return false;
+    thisCurrent = thisCurrent->links()[0].next;
+    otherCurrent = otherCurrent->links()[0].next;
+  }
+  return true;
+}
+
+template <typename T>
+const bool SkipList<T>::operator!=(const SkipList& other) const {
+  return !this->operator==(other);
+}
+
+template <typename T>
+const T& SkipList<T>::operator[](const std::size_t index) const {
+  if (index >= this->length) throw ListIndexOutOfBounds(index, this->length);
+  return this->nodeAt(index)->data;
+}
+
+template <typename T>
+T& SkipList<T>::operator[](const std::size_t index) {
+  if (index >= this->length) throw ListIndexOutOfBounds(index, this->length);
+  return this->nodeAt(index)->data;
+}
+
+template <typename T>
+SkipNode<T>* SkipList<T>::first() const {
+  return this->head.empty() ? nullptr : this->head[0].next;
+}
+
+template <typename T>
+SkipLink<T>* SkipList<T>::linksOf(SkipNode<T>* node) {
+  return node ? node->links() : this->head.data();
+}
+
+template <typename T>
+const SkipLink<T>* SkipList<T>::linksOf(const SkipNode<T>* node) const {
+  return node ? node->links() : this->head.data();
+}
+
+template <typename T>
+SkipNode<T>* SkipList<T>::nodeAt(const std::size_t index) const {
+  const SkipNode<T>* current = nullptr;
+  std::size_t position = 0;
+  for (std::size_t level = this->head.size(); level-- > 0;) {
+    const SkipLink<T>* links = this->linksOf(current);
+    while (links[level].next && position + links[level].width <= index + 1) {
+      position += links[level].width;
+      current = links[level].next;
+      links = current->links();
+    }
+    if (position == index + 1) break;
+  }
+  return const_cast<SkipNode<T>*>(current);
+}
+
+// Geometric with p = 1/4, which averages 1.33 links per node.
+template <typename T>
+std::size_t SkipList<T>::randomHeight() {
+  this->seed ^= this->seed << 13;
+  this->seed ^= this->seed >> 7;
+  this->seed ^= this->seed << 17;
+  std::size_t height = 1;
+  for (uint64_t bits = this->seed; (bits & 3) == 0 && height < maxHeight; bits >>= 2)
+    ++height;
+  return height;
+}
+
+#endif
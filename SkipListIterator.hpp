@@ -0,0 +1,44 @@
+#ifndef SKIPLISTITERATOR_HPP
+#define SKIPLISTITERATOR_HPP
+
+#include <stddef.h>
+#include <iterator>
+#include "SkipNode.hpp"
+
+template <typename T>
+class SkipListIterator {
+ public:
+  using iterator_category = std::forward_iterator_tag;
+  using value_type = T;
+  using difference_type = std::ptrdiff_t;
+  using pointer = T*;
+  using reference = T&;
+
+  SkipListIterator() : current(nullptr) {}
+  SkipListIterator(SkipNode<T>* start) : current(start) {}
+  SkipListIterator<T>& operator++() {
+    this->current = this->current->links()[0].next;
+    return *this;
+  }
+  SkipListIterator<T> operator++(int) {
+    SkipListIterator<T> previous = *this;
+    this->current = this->current->links()[0].next;
+    return previous;
+  }
+  T& operator*() const {
+    return this->current->data;
+  }
+  T* operator->() const {
+    return &this->current->data;
+  }
+  const bool operator==(const SkipListIterator<T>& other) const {
+    return this->current == other.current;
+  }
+  const bool operator!=(const SkipListIterator<T>& other) const {
+    return this->current != other.current;
+  }
+ private:
+  SkipNode<T>* current;
+};
+
+#endif
@@ -0,0 +1,83 @@
+#ifndef SKIPNODE_HPP
+#define SKIPNODE_HPP
+
+#include <stddef.h>
+#include <new>
+#include <ostream>
+#include <utility>
+
+template <typename T>
+struct SkipNode;
+
+// Forward link of an indexable skip list. `width` is the number of positions
+// the link skips over, counting the end of the list as one past the last
+// element.
+template <typename T>
+struct SkipLink {
+  SkipNode<T>* next;
+  std::size_t width;
+};
+
+// Node whose `height` links are stored directly after it in the same
+// allocation, so a node costs one allocation whatever its height.
+template <typename T>
+struct SkipNode {
+  T data;
+  std::size_t height;
+
+  SkipLink<T>* links();
+  const SkipLink<T>* links() const;
+
+  template <typename... Args>
+  static SkipNode* create(const std::size_t, Args&&...);
+  static void destroy(SkipNode*);
+
+  friend std::ostream& operator<<(std::ostream& output, const SkipNode& self) {
+    output << "Data: " << self.data << "Height: " << self.height;
+    return output;
+  }
+
+ private:
+  template <typename... Args>
+  SkipNode(const std::size_t, Args&&...);
+};
+
+template <typename T>
+template <typename... Args>
+SkipNode<T>::SkipNode(const std::size_t height, Args&&... args)
+    : data(std::forward<Args>(args)...), height(height) {
+  for (std::size_t level = 0; level < height; ++level)
+    new (this->links() + level) SkipLink<T>{nullptr, 0};
+}
+
+template <typename T>
+SkipLink<T>* SkipNode<T>::links() {
+  return reinterpret_cast<SkipLink<T>*>(this + 1);
+}
+
+template <typename T>
+const SkipLink<T>* SkipNode<T>::links() const {
+  return reinterpret_cast<const SkipLink<T>*>(this + 1);
+}
+
+template <typename T>
+template <typename... Args>
+SkipNode<T>* SkipNode<T>::create(const std::size_t height, Args&&... args) {
+  static_assert(sizeof(SkipNode) % alignof(SkipLink<T>) == 0,
+                "links must be aligned directly after the node");
+  void* raw = ::operator new(sizeof(SkipNode) + height * sizeof(SkipLink<T>));
+  try {
+    return new (raw) SkipNode(height, std::forward<Args>(args)...);
+  } catch (...) {
+    ::operator delete(raw);
+    throw;
+  }
+}
+
+template <typename T>
+void SkipNode<T>::destroy(SkipNode* node) {
+  node->~SkipNode();
+  ::operator delete(node);
+}
+
+#endif
@@ -0,0 +1,211 @@
+#ifndef SLABALLOCATOR_HPP
+#define SLABALLOCATOR_HPP
+
+#include <stddef.h>
+#include <algorithm>
+#include <memory>
+#include <new>
+#include <vector>
+
+// Fixed-size block pool. Blocks are carved from contiguous slabs and recycled
+// through an intrusive free list threaded through the unused blocks.
+class SlabPool {
+ public:
+  SlabPool(const std::size_t, const std::size_t, const std::size_t);
+  SlabPool(const SlabPool&) = delete;
+  SlabPool& operator=(const SlabPool&) = delete;
+  ~SlabPool();
+
+  void* allocate();
+  void deallocate(void*);
+  void reserve(const std::size_t);
+
+  const std::size_t getBlockSize() const;
+  const std::size_t getBlockAlign() const;
+
+ private:
+  struct FreeBlock {
+    FreeBlock* next;
+  };
+
+  void grow(const std::size_t);
+
+  std::size_t blockSize;
+  std::size_t blockAlign;
+  std::size_t blocksPerSlab;
+  FreeBlock* freeList;
+  FreeBlock* freeTail;
+  std::size_t available;
+  std::vector<void*> slabs;
+};
+
+inline SlabPool::SlabPool(const std::size_t size, const std::size_t align,
+                          const std::size_t count)
+    : blockSize(size < sizeof(FreeBlock) ? sizeof(FreeBlock) : size),
+      blockAlign(align < alignof(FreeBlock) ? alignof(FreeBlock) : align),
+      blocksPerSlab(count ? count : 1),
+      freeList(nullptr),
+      freeTail(nullptr),
+      available(0) {
+  this->blockSize =
+      (this->blockSize + this->blockAlign - 1) / this->blockAlign * this->blockAlign;
+}
+
+inline SlabPool::~SlabPool() {
+  for (void* slab : this->slabs)
+    ::operator delete(slab, std::align_val_t(this->blockAlign));
+}
+
+inline void* SlabPool::allocate() {
+  if (!this->freeList) this->grow(this->blocksPerSlab);
+  FreeBlock* block = this->freeList;
+  this->freeList = block->next;
+  if (!this->freeList) this->freeTail = nullptr;
+  --this->available;
+  return block;
+}
+
+inline void SlabPool::deallocate(void* pointer) {
+  FreeBlock* block = static_cast<FreeBlock*>(pointer);
+  block->next = this->freeList;
+  if (!this->freeList) this->freeTail = block;
+  this->freeList = block;
+  ++this->available;
+}
+
+// Makes sure the next `count` allocations need no new slab. Blocks missing
+// from the free list are carved from a single slab, queued after the free
+// blocks, so a bulk insertion gets them in address order.
+inline void SlabPool::reserve(const std::size_t count) {
+  if (count > this->available)
+    this->grow(std::max(count - this->available, this->blocksPerSlab));
+}
+
+inline const std::size_t SlabPool::getBlockSize() const {
+  return this->blockSize;
+}
+
+inline const std::size_t SlabPool::getBlockAlign() const {
+  return this->blockAlign;
+}
+
+// Adds a slab of `count` blocks behind the blocks already free, which
+// freeTail reaches without walking the free list.
+inline void SlabPool::grow(const std::size_t count) {
+  this->slabs.reserve(this->slabs.size() + 1);
+  char* slab = static_cast<char*>(
+      ::operator new(this->blockSize * count, std::align_val_t(this->blockAlign)));
+  this->slabs.push_back(slab);
+  // Thread back to front so blocks are handed out in address order.
+  FreeBlock* rest = nullptr;
+  for (std::size_t i = count; i-- > 0;) {
+    FreeBlock* block = reinterpret_cast<FreeBlock*>(slab + i * this->blockSize);
+    block->next = rest;
+    rest = block;
+  }
+  if (this->freeTail)
+    this->freeTail->next = rest;
+  else
+    this->freeList = rest;
+  this->freeTail = reinterpret_cast<FreeBlock*>(slab + (count - 1) * this->blockSize);
+  this->available += count;
+}
+
+// Set of pools keyed by block geometry, shared by every copy and rebind of a
+// SlabAllocator so that all containers built from one allocator draw from the
+// same slabs. Not thread safe.
+class SlabArena {
+ public:
+  explicit SlabArena(const std::size_t blocksPerSlab) : blocksPerSlab(blocksPerSlab) {}
+
+  SlabPool& pool(const std::size_t size, const std::size_t align) {
+    for (Entry& entry : this->pools)
+      if (entry.size == size && entry.align == align) return *entry.pool;
+    this->pools.push_back(
+        Entry{size, align, std::unique_ptr<SlabPool>(
+                               new SlabPool(size, align, this->blocksPerSlab))});
+    return *this->pools.back().pool;
+  }
+
+ private:
+  struct Entry {
+    std::size_t size;
+    std::size_t align;
+    std::unique_ptr<SlabPool> pool;
+  };
+
+  std::size_t blocksPerSlab;
+  std::vector<Entry> pools;
+};
+
+template <typename T, std::size_t BlocksPerSlab = 256>
+class SlabAllocator {
+ public:
+  using value_type = T;
+  template <typename U>
+  struct rebind {
+    using other = SlabAllocator<U, BlocksPerSlab>;
+  };
+
+  // Constructors
+  SlabAllocator();
+  template <typename U>
+  SlabAllocator(const SlabAllocator<U, BlocksPerSlab>&);
+
+  // Allocation
+  T* allocate(const std::size_t);
+  void deallocate(T*, const std::size_t);
+  void reserve(const std::size_t);
+
+  // Operators
+  template <typename U>
+  const bool operator==(const SlabAllocator<U, BlocksPerSlab>& other) const {
+    return this->arena == other.arena;
+  }
+  template <typename U>
+  const bool operator!=(const SlabAllocator<U, BlocksPerSlab>& other) const {
+    return this->arena != other.arena;
+  }
+
+ private:
+  template <typename U, std::size_t>
+  friend class SlabAllocator;
+
+  std::shared_ptr<SlabArena> arena;
+  SlabPool* pool;
+};
+
+template <typename T, std::size_t BlocksPerSlab>
+SlabAllocator<T, BlocksPerSlab>::SlabAllocator()
+    : arena(std::make_shared<SlabArena>(BlocksPerSlab)),
+      pool(&this->arena->pool(sizeof(T), alignof(T))) {}
+
+template <typename T, std::size_t BlocksPerSlab>
+template <typename U>
+SlabAllocator<T, BlocksPerSlab>::SlabAllocator(
+    const SlabAllocator<U, BlocksPerSlab>& other)
+    : arena(other.arena), pool(&this->arena->pool(sizeof(T), alignof(T))) {}
+
+template <typename T, std::size_t BlocksPerSlab>
+T* SlabAllocator<T, BlocksPerSlab>::allocate(const std::size_t count) {
+  if (count == 1) return static_cast<T*>(this->pool->allocate());
+  return static_cast<T*>(
+      ::operator new(count * sizeof(T), std::align_val_t(alignof(T))));
+}
+
+template <typename T, std::size_t BlocksPerSlab>
+void SlabAllocator<T, BlocksPerSlab>::deallocate(T* pointer, const std::size_t count) {
+  if (count == 1)
+    this->pool->deallocate(pointer);
+  else
+    ::operator delete(pointer, std::align_val_t(alignof(T)));
+}
+
+// Prepares the pool for `count` single-object allocations, which lists
+// inserting a range of elements request up front.
+template <typename T, std::size_t BlocksPerSlab>
+void SlabAllocator<T, BlocksPerSlab>::reserve(const std::size_t count) {
+  this->pool->reserve(count);
+}
+
+#endif
@@ -0,0 +1,334 @@
+#ifndef SMALLLINKEDLIST_HPP
+#define SMALLLINKEDLIST_HPP
+
+#include <stddef.h>
+#include <stdint.h>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <new>
+#include <ostream>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include "LinkedList.hpp"
+#include "ListIndexOutOfBounds.hpp"
+#include "Node.hpp"
+
+// Storage for up to Capacity nodes of type Slot inside the object that holds
+// it. A bit per slot records whether it is vacant.
+template <typename Slot, std::size_t Capacity>
+class InlineNodes {
+  static_assert(Capacity > 0 && Capacity <= 64, "between 1 and 64 inline nodes");
+
+ public:
+  InlineNodes() : vacant(Capacity == 64 ? ~uint64_t(0) : (uint64_t(1) << Capacity) - 1) {}
+  InlineNodes(const InlineNodes&) = delete;
+  InlineNodes& operator=(const InlineNodes&) = delete;
+
+  // A free slot, or null when all of them are taken. Lowest slots first.
+  Slot* allocate() {
+    if (!this->vacant) return nullptr;
+    const std::size_t slot = __builtin_ctzll(this->vacant);
+    this->vacant &= this->vacant - 1;
+    return reinterpret_cast<Slot*>(this->slots[slot]);
+  }
+  const bool owns(const Slot* pointer) const {
+    const unsigned char* bytes = reinterpret_cast<const unsigned char*>(pointer);
+    return bytes >= this->slots[0] && bytes < this->slots[Capacity];
+  }
+  void deallocate(Slot* pointer) {
+    const std::size_t slot = reinterpret_cast<unsigned char*>(pointer) - this->slots[0];
+    this->vacant |= uint64_t(1) << (slot / sizeof(Slot));
+  }
+
+ private:
+  alignas(Slot) unsigned char slots[Capacity][sizeof(Slot)];
+  uint64_t vacant;
+};
+
+// Allocator of a SmallLinkedList: single Slot objects come from the list's
+// inline nodes while any is free, everything else from the heap. Allocators
+// are equal only when they share inline nodes, since a node can only go back
+// to the storage it came from. Lists with different inline nodes therefore
+// move elements between them one by one, as for any unequal allocators. A
+// copy made for a new container has no inline nodes and uses only the heap,
+// so that the container does not depend on the object holding them.
+template <typename T, typename Slot, std::size_t Capacity>
+class InlineNodeAllocator {
+ public:
+  using value_type = T;
+  template <typename U>
+  struct rebind {
+    using other = InlineNodeAllocator<U, Slot, Capacity>;
+  };
+
+  // Constructors
+  explicit InlineNodeAllocator(InlineNodes<Slot, Capacity>* nodes) : nodes(nodes) {}
+  template <typename U>
+  InlineNodeAllocator(const InlineNodeAllocator<U, Slot, Capacity>& other) : nodes(other.nodes) {}
+  InlineNodeAllocator select_on_container_copy_construction() const {
+    return InlineNodeAllocator(nullptr);
+  }
+
+  // Allocation
+  T* allocate(const std::size_t count) {
+    if (std::is_same<T, Slot>::value && count == 1 && this->nodes)
+      if (Slot* slot = this->nodes->allocate()) return reinterpret_cast<T*>(slot);
+    return static_cast<T*>(::operator new(count * sizeof(T), std::align_val_t(alignof(T))));
+  }
+  void deallocate(T* pointer, const std::size_t count) {
+    const Slot* slot = reinterpret_cast<const Slot*>(pointer);
+    if (std::is_same<T, Slot>::value && count == 1 && this->nodes && this->nodes->owns(slot))
+      this->nodes->deallocate(reinterpret_cast<Slot*>(pointer));
+    else
+      ::operator delete(pointer, std::align_val_t(alignof(T)));
+  }
+
+  // Operators
+  template <typename U>
+  const bool operator==(const InlineNodeAllocator<U, Slot, Capacity>& other) const {
+    return this->nodes == other.nodes;
+  }
+  template <typename U>
+  const bool operator!=(const InlineNodeAllocator<U, Slot, Capacity>& other) const {
+    return this->nodes != other.nodes;
+  }
+
+ private:
+  template <typename, typename, std::size_t>
+  friend class InlineNodeAllocator;
+
+  InlineNodes<Slot, Capacity>* nodes;
+};
+
+// LinkedList keeping up to Capacity nodes inside the list object, so that a
+// list that stays that small never touches the heap; further nodes spill to
+// the heap, and slots freed by removals are reused before it. It has the
+// interface of LinkedList, which it inherits privately: a LinkedList
+// reference to it would let copies, moves and splits of that LinkedList keep
+// nodes inside this object. Unlike LinkedList:
+// - moving a list moves its elements one by one, since inline nodes cannot
+//   change owner, which is cheap for the small lists this is meant for;
+// - splicing and merging between two small lists moves elements the same way;
+// - splitAt returns a SmallLinkedList with inline nodes of its own;
+// - there is no getAllocator, whose result refers to the inline nodes.
+// The inline nodes are a base constructed before the list and destroyed
+// after it.
+template <typename T, std::size_t Capacity = 8>
+class SmallLinkedList
+    : private InlineNodes<Node<T>, Capacity>,
+      private LinkedList<T, InlineNodeAllocator<T, Node<T>, Capacity>> {
+  using Nodes = InlineNodes<Node<T>, Capacity>;
+  using List = LinkedList<T, InlineNodeAllocator<T, Node<T>, Capacity>>;
+
+ public:
+  using typename List::value_type;
+  using typename List::size_type;
+  using typename List::difference_type;
+  using typename List::reference;
+  using typename List::const_reference;
+  using typename List::iterator;
+  using typename List::const_iterator;
+
+  // Constructors
+  SmallLinkedList() : List(typename List::allocator_type(static_cast<Nodes*>(this))) {}
+  SmallLinkedList(const T& data) : SmallLinkedList() {
+    this->List::append(data);
+  }
+  SmallLinkedList(const std::initializer_list<T> args) : SmallLinkedList() {
+    this->List::appendRange(args.begin(), args.end());
+  }
+  template <typename InputIt, typename = typename List::template IteratorCategory<InputIt>>
+  SmallLinkedList(InputIt first, InputIt last) : SmallLinkedList() {
+    this->List::appendRange(first, last);
+  }
+  SmallLinkedList(const SmallLinkedList& other) : SmallLinkedList() {
+    this->List::appendRange(other.begin(), other.end());
+  }
+  SmallLinkedList(SmallLinkedList&& other) : SmallLinkedList() {
+    this->List::operator=(std::move(other));
+  }
+  SmallLinkedList& operator=(const SmallLinkedList& other) {
+    this->List::operator=(other);
+    return *this;
+  }
+  SmallLinkedList& operator=(SmallLinkedList&& other) {
+    this->List::operator=(std::move(other));
+    return *this;
+  }
+
+  // Getters
+  using List::getHead;
+  using List::getTail;
+  using List::isEmpty;
+  using List::contains;
+  using List::size;
+  using List::getStatistics;
+  static constexpr std::size_t inlineCapacity() {
+    return Capacity;
+  }
+
+  // Mutators
+  SmallLinkedList& append(const T& data) {
+    this->List::append(data);
+    return *this;
+  }
+  SmallLinkedList& append(T&& data) {
+    this->List::append(std::move(data));
+    return *this;
+  }
+  SmallLinkedList& prepend(const T& data) {
+    this->List::prepend(data);
+    return *this;
+  }
+  SmallLinkedList& prepend(T&& data) {
+    this->List::prepend(std::move(data));
+    return *this;
+  }
+  SmallLinkedList& insert(const T& data, const std::size_t index) {
+    this->List::insert(data, index);
+    return *this;
+  }
+  SmallLinkedList& insert(T&& data, const std::size_t index) {
+    this->List::insert(std::move(data), index);
+    return *this;
+  }
+  template <typename InputIt, typename = typename List::template IteratorCategory<InputIt>>
+  SmallLinkedList& appendRange(InputIt first, InputIt last) {
+    this->List::appendRange(first, last);
+    return *this;
+  }
+  template <typename InputIt, typename = typename List::template IteratorCategory<InputIt>>
+  SmallLinkedList& prependRange(InputIt first, InputIt last) {
+    this->List::prependRange(first, last);
+    return *this;
+  }
+  template <typename InputIt, typename = typename List::template IteratorCategory<InputIt>>
+  SmallLinkedList& insertRange(const std::size_t index, InputIt first, InputIt last) {
+    this->List::insertRange(index, first, last);
+    return *this;
+  }
+  template <typename... Args>
+  SmallLinkedList& emplaceBack(Args&&... args) {
+    this->List::emplaceBack(std::forward<Args>(args)...);
+    return *this;
+  }
+  template <typename... Args>
+  SmallLinkedList& emplaceFront(Args&&... args) {
+    this->List::emplaceFront(std::forward<Args>(args)...);
+    return *this;
+  }
+  template <typename... Args>
+  SmallLinkedList& emplace(const std::size_t index, Args&&... args) {
+    this->List::emplace(index, std::forward<Args>(args)...);
+    return *this;
+  }
+  using List::unappend;
+  using List::unprepend;
+  using List::remove;
+  SmallLinkedList& remove(const T& data, const std::size_t count) {
+    this->List::remove(data, count);
+    return *this;
+  }
+  using List::clear;
+
+  // Relinking
+  SmallLinkedList& splice(SmallLinkedList&& other) {
+    this->List::splice(std::move(other));
+    return *this;
+  }
+  SmallLinkedList& splice(const std::size_t index, SmallLinkedList&& other) {
+    this->List::splice(index, std::move(other));
+    return *this;
+  }
+  SmallLinkedList& splice(SmallLinkedList& other, const_iterator first, const_iterator last) {
+    this->List::splice(other, first, last);
+    return *this;
+  }
+  SmallLinkedList splitAt(const std::size_t index) {
+    if (index > this->size()) throw ListIndexOutOfBounds(index, this->size());
+    SmallLinkedList rest;
+    rest.splice(*this, std::next(this->cbegin(), index), this->cend());
+    return rest;
+  }
+
+  // Files
+  using List::save;
+  SmallLinkedList& load(const std::string& path) {
+    this->List::load(path);
+    return *this;
+  }
+
+  // Traversal
+  SmallLinkedList& setPrefetching(const bool enabled) {
+    this->List::setPrefetching(enabled);
+    return *this;
+  }
+  using List::isPrefetching;
+  template <typename Function>
+  SmallLinkedList& forEach(Function function) {
+    this->List::forEach(function);
+    return *this;
+  }
+  template <typename Function>
+  const SmallLinkedList& forEach(Function function) const {
+    this->List::forEach(function);
+    return *this;
+  }
+
+  // Layout
+  SmallLinkedList& relayout() {
+    this->List::relayout();
+    return *this;
+  }
+  using List::relayout;
+
+  // Parallel traversal
+  template <typename Function>
+  SmallLinkedList& parallelForEach(Function function, ThreadPool& pool = ThreadPool::shared()) {
+    this->List::parallelForEach(function, pool);
+    return *this;
+  }
+  using List::parallelTransform;
+  using List::parallelReduce;
+
+  // Ordering
+  template <typename Compare = std::less<T>>
+  SmallLinkedList& sort(Compare compare = Compare()) {
+    this->List::sort(compare);
+    return *this;
+  }
+  template <typename Compare = std::less<T>>
+  SmallLinkedList& merge(SmallLinkedList&& other, Compare compare = Compare()) {
+    this->List::merge(std::move(other), compare);
+    return *this;
+  }
+  template <typename BinaryPredicate = std::equal_to<T>>
+  SmallLinkedList& unique(BinaryPredicate predicate = BinaryPredicate()) {
+    this->List::unique(predicate);
+    return *this;
+  }
+
+  // Iterators
+  using List::begin;
+  using List::end;
+  using List::cbegin;
+  using List::cend;
+
+  // Operators
+  const bool operator==(const SmallLinkedList& other) const {
+    return this->List::operator==(other);
+  }
+  const bool operator!=(const SmallLinkedList& other) const {
+    return this->List::operator!=(other);
+  }
+  using List::operator[];
+
+  // Friend Operator
+  friend std::ostream& operator<<(std::ostream& output, const SmallLinkedList& self) {
+    return output << static_cast<const List&>(self);
+  }
+};
+
+#endif
@@ -0,0 +1,381 @@
+#ifndef STATICLINKEDLIST_HPP
+#define STATICLINKEDLIST_HPP
+
+#include <stddef.h>
+#include <stdint.h>
+#include <initializer_list>
+#include <ostream>
+#include <type_traits>
+#include <utility>
+#include "ListIndexOutOfBounds.hpp"
+#include "StaticLinkedListIterator.hpp"
+
+// Singly linked list of at most Capacity elements stored inline: an element
+// array, a parallel array of successor indices and a free stack threaded
+// through it. Nothing is ever allocated, so it can live on the stack, inside
+// another object or in static storage. Links use the smallest unsigned type
+// that can index Capacity slots.
+//
+// Every operation is constexpr. For a literal T, such as an arithmetic type,
+// a list can be built, changed and traversed in a constant expression. T must
+// be default constructible: unused slots hold a value-initialized T, and a
+// removed element is overwritten with one so it releases what it owns.
+//
+// append, prepend and insert throw ListIndexOutOfBounds when the list is
+// full. tryAppend, tryPrepend and tryInsert return false instead.
+template <typename T, std::size_t Capacity>
+class StaticLinkedList {
+  static_assert(Capacity > 0, "StaticLinkedList needs room for at least one element");
+  static_assert(Capacity < UINT32_MAX, "StaticLinkedList holds fewer than 2^32 - 1 elements");
+
+ public:
+  using Index = typename std::conditional<
+      (Capacity < UINT8_MAX), uint8_t,
+      typename std::conditional<(Capacity < UINT16_MAX), uint16_t, uint32_t>::type>::type;
+  using value_type = T;
+  using size_type = std::size_t;
+  using reference = T&;
+  using const_reference = const T&;
+  using iterator = StaticLinkedListIterator<T, Index>;
+  using const_iterator = StaticLinkedListIterator<T, Index, true>;
+
+  // Constructors
+  constexpr StaticLinkedList();
+  constexpr StaticLinkedList(const T&);
+  constexpr StaticLinkedList(const std::initializer_list<T>);
+
+  // Getters
+  constexpr const T& getHead() const;
+  constexpr const T& getTail() const;
+  constexpr const bool isEmpty() const;
+  constexpr const bool isFull() const;
+  constexpr const bool contains(const T&) const;
+  constexpr const std::size_t size() const;
+  static constexpr std::size_t capacity() { return Capacity; }
+
+  // Mutators
+  constexpr StaticLinkedList<T, Capacity>& append(const T&);
+  constexpr StaticLinkedList<T, Capacity>& append(T&&);
+  constexpr StaticLinkedList<T, Capacity>& prepend(const T&);
+  constexpr StaticLinkedList<T, Capacity>& prepend(T&&);
+  constexpr StaticLinkedList<T, Capacity>& insert(const T&, const std::size_t);
+  constexpr StaticLinkedList<T, Capacity>& insert(T&&, const std::size_t);
+  constexpr bool tryAppend(const T&);
+  constexpr bool tryPrepend(const T&);
+  constexpr bool tryInsert(const T&, const std::size_t);
+  constexpr T unappend();
+  constexpr T unprepend();
+  constexpr T remove(const std::size_t);
+  constexpr StaticLinkedList<T, Capacity>& remove(const T&, const std::size_t);
+  constexpr void clear();
+
+  // Iterators
+  constexpr iterator begin();
+  constexpr iterator end();
+  constexpr const_iterator begin() const;
+  constexpr const_iterator end() const;
+  constexpr const_iterator cbegin() const;
+  constexpr const_iterator cend() const;
+
+  // Operators
+  constexpr const bool operator==(const StaticLinkedList&) const;
+  constexpr const bool operator!=(const StaticLinkedList&) const;
+  constexpr const T& operator[](const std::size_t) const;
+  constexpr T& operator[](const std::size_t);
+
+  // Friend Operator
+  friend std::ostream& operator<<(std::ostream& output, const StaticLinkedList& self) {
+    output << "[";
+    for (Index slot = self.head; slot != none; slot = self.links[slot]) {
+      output << self.values[slot];
+      if (self.links[slot] != none) output << "->";
+    }
+    output << "]";
+    return output;
+  }
+
+ private:
+  // End of a chain, in both the list and the free stack.
+  static constexpr Index none = Capacity;
+
+  template <typename Value>
+  constexpr bool place(Value&&, const std::size_t);
+  constexpr Index slotAt(const std::size_t) const;
+  constexpr T release(Index, Index);
+
+  T values[Capacity];
+  Index links[Capacity];
+  Index head;
+  Index tail;
+  Index freeSlot;
+  // Slots handed out so far; those at or above it have never been used.
+  Index used;
+  Index length;
+};
+
+template <typename T, std::size_t Capacity>
+constexpr StaticLinkedList<T, Capacity>::StaticLinkedList()
+    : values(), links(), head(none), tail(none), freeSlot(none), used(0), length(0) {}
+
+template <typename T, std::size_t Capacity>
+constexpr StaticLinkedList<T, Capacity>::StaticLinkedList(const T& data) : StaticLinkedList() {
+  this->append(data);
+}
+
+template <typename T, std::size_t Capacity>
+constexpr StaticLinkedList<T, Capacity>::StaticLinkedList(const std::initializer_list<T> args)
+    : StaticLinkedList() {
+  for (const T& data : args) this->append(data);
+}
+
+template <typename T, std::size_t Capacity>
+constexpr const T& StaticLinkedList<T, Capacity>::getHead() const {
+  if (this->isEmpty()) throw ListIndexOutOfBounds();
+  return this->values[this->head];
+}
+
+template <typename T, std::size_t Capacity>
+constexpr const T& StaticLinkedList<T, Capacity>::getTail() const {
+  if (this->isEmpty()) throw ListIndexOutOfBounds();
+  return this->values[this->tail];
+}
+
+template <typename T, std::size_t Capacity>
+constexpr const bool StaticLinkedList<T, Capacity>::isEmpty() const {
+  return this->length == 0;
+}
+
+template <typename T, std::size_t Capacity>
+constexpr const bool StaticLinkedList<T, Capacity>::isFull() const {
+  return this->length == Capacity;
+}
+
+template <typename T, std::size_t Capacity>
+constexpr const bool StaticLinkedList<T, Capacity>::contains(const T& data) const {
+  for (Index slot = this->head; slot != none; slot = this->links[slot])
+    if (this->values[slot] == data) return true;
+  return false;
+}
+
+template <typename T, std::size_t Capacity>
+constexpr const std::size_t StaticLinkedList<T, Capacity>::size() const {
+  return this->length;
+}
+
+template <typename T, std::size_t Capacity>
+constexpr StaticLinkedList<T, Capacity>& StaticLinkedList<T, Capacity>::append(const T& data) {
+  return this->insert(data, this->length);
+}
+
+template <typename T, std::size_t Capacity>
+constexpr StaticLinkedList<T, Capacity>& StaticLinkedList<T, Capacity>::append(T&& data) {
+  return this->insert(std::move(data), this->length);
+}
+
+template <typename T, std::size_t Capacity>
+constexpr StaticLinkedList<T, Capacity>& StaticLinkedList<T, Capacity>::prepend(const T& data) {
+  return this->insert(data, 0);
+}
+
+template <typename T, std::size_t Capacity>
+constexpr StaticLinkedList<T, Capacity>& StaticLinkedList<T, Capacity>::prepend(T&& data) {
+  return this->insert(std::move(data), 0);
+}
+
+template <typename T, std::size_t Capacity>
+constexpr StaticLinkedList<T, Capacity>& StaticLinkedList<T, Capacity>::insert(
+    const T& data, const std::size_t index) {
+  if (index > this->length) throw ListIndexOutOfBounds(index, this->length);
+  if (!this->place(data, index)) throw ListIndexOutOfBounds(this->length, Capacity);
+  return *this;
+}
+
+template <typename T, std::size_t Capacity>
+constexpr StaticLinkedList<T, Capacity>& StaticLinkedList<T, Capacity>::insert(
+    T&& data, const std::size_t index) {
+  if (index > this->length) throw ListIndexOutOfBounds(index, this->length);
+  if (!this->place(std::move(data), index)) throw ListIndexOutOfBounds(this->length, Capacity);
+  return *this;
+}
+
+template <typename T, std::size_t Capacity>
+constexpr bool StaticLinkedList<T, Capacity>::tryAppend(const T& data) {
+  return this->place(data, this->length);
+}
+
+template <typename T, std::size_t Capacity>
+constexpr bool StaticLinkedList<T, Capacity>::tryPrepend(const T& data) {
+  return this->place(data, 0);
+}
+
+// Also returns false, without inserting, for an index past the end.
+template <typename T, std::size_t Capacity>
+constexpr bool StaticLinkedList<T, Capacity>::tryInsert(const T& data, const std::size_t index) {
+  return index <= this->length && this->place(data, index);
+}
+
+template <typename T, std::size_t Capacity>
+constexpr T StaticLinkedList<T, Capacity>::unappend() {
+  if (this->isEmpty()) throw ListIndexOutOfBounds(0, 0);
+  return this->release(this->length > 1 ? this->slotAt(this->length - 2) : none, this->tail);
+}
+
+template <typename T, std::size_t Capacity>
+constexpr T StaticLinkedList<T, Capacity>::unprepend() {
+  if (this->isEmpty()) throw ListIndexOutOfBounds(0, 0);
+  return this->release(none, this->head);
+}
+
+template <typename T, std::size_t Capacity>
+constexpr T StaticLinkedList<T, Capacity>::remove(const std::size_t index) {
+  if (index >= this->length) throw ListIndexOutOfBounds(index, this->length);
+  Index prior = index ? this->slotAt(index - 1) : none;
+  return this->release(prior, prior == none ? this->head : this->links[prior]);
+}
+
+template <typename T, std::size_t Capacity>
+constexpr StaticLinkedList<T, Capacity>& StaticLinkedList<T, Capacity>::remove(
+    const T& data, const std::size_t num) {
+  std::size_t numRemoved = 0;
+  Index prior = none;
+  Index slot = this->head;
+  while (numRemoved < num && slot != none) {
+    Index next = this->links[slot];
+    if (this->values[slot] == data) {
+      this->release(prior, slot);
+      ++numRemoved;
+    } else {
+      prior = slot;
+    }
+    slot = next;
+  }
+  return *this;
+}
+
+template <typename T, std::size_t Capacity>
+constexpr void StaticLinkedList<T, Capacity>::clear() {
+  for (Index slot = this->head; slot != none; slot = this->links[slot]) this->values[slot] = T();
+  this->head = none;
+  this->tail = none;
+  this->freeSlot = none;
+  this->used = 0;
+  this->length = 0;
+}
+
+template <typename T, std::size_t Capacity>
+constexpr typename StaticLinkedList<T, Capacity>::iterator StaticLinkedList<T, Capacity>::begin() {
+  return iterator(this->values, this->links, this->head);
+}
+
+template <typename T, std::size_t Capacity>
+constexpr typename StaticLinkedList<T, Capacity>::iterator StaticLinkedList<T, Capacity>::end() {
+  return iterator(this->values, this->links, none);
+}
+
+template <typename T, std::size_t Capacity>
+constexpr typename StaticLinkedList<T, Capacity>::const_iterator
+StaticLinkedList<T, Capacity>::begin() const {
+  return const_iterator(this->values, this->links, this->head);
+}
+
+template <typename T, std::size_t Capacity>
+constexpr typename StaticLinkedList<T, Capacity>::const_iterator
+StaticLinkedList<T, Capacity>::end() const {
+  return const_iterator(this->values, this->links, none);
+}
+
+template <typename T, std::size_t Capacity>
+constexpr typename StaticLinkedList<T, Capacity>::const_iterator
+StaticLinkedList<T, Capacity>::cbegin() const {
+  return this->begin();
+}
+
+template <typename T, std::size_t Capacity>
+constexpr typename StaticLinkedList<T, Capacity>::const_iterator
+StaticLinkedList<T, Capacity>::cend() const {
+  return this->end();
+}
+
+template <typename T, std::size_t Capacity>
+constexpr const bool StaticLinkedList<T, Capacity>::operator==(
+    const StaticLinkedList& other) const {
+  if (this->length != other.length) return false;
+  Index otherSlot = other.head;
+  for (Index slot = this->head; slot != none; slot = this->links[slot]) {
+    if (this->values[slot] != other.values[otherSlot]) return false;
+    otherSlot = other.links[otherSlot];
+  }
+  return true;
+}
+
+template <typename T, std::size_t Capacity>
+constexpr const bool StaticLinkedList<T, Capacity>::operator!=(
+    const StaticLinkedList& other) const {
+  return !this->operator==(other);
+}
+
+template <typename T, std::size_t Capacity>
+constexpr const T& StaticLinkedList<T, Capacity>::operator[](const std::size_t index) const {
+  if (index >= this->length) throw ListIndexOutOfBounds(index, this->length);
+  return this->values[this->slotAt(index)];
+}
+
+template <typename T, std::size_t Capacity>
+constexpr T& StaticLinkedList<T, Capacity>::operator[](const std::size_t index) {
+  if (index >= this->length) throw ListIndexOutOfBounds(index, this->length);
+  return this->values[this->slotAt(index)];
+}
+
+// Stores `data` in a free slot, reusing removed slots first, and links it in
+// at `index`, which the caller has checked. Returns false when full.
+template <typename T, std::size_t Capacity>
+template <typename Value>
+constexpr bool StaticLinkedList<T, Capacity>::place(Value&& data, const std::size_t index) {
+  if (this->isFull()) return false;
+  Index prior = index ? this->slotAt(index - 1) : none;
+  Index slot = this->freeSlot;
+  if (slot != none)
+    this->freeSlot = this->links[slot];
+  else
+    slot = this->used++;
+  this->values[slot] = std::forward<Value>(data);
+  if (prior == none) {
+    this->links[slot] = this->head;
+    this->head = slot;
+  } else {
+    this->links[slot] = this->links[prior];
+    this->links[prior] = slot;
+  }
+  if (index == this->length) this->tail = slot;
+  ++this->length;
+  return true;
+}
+
+template <typename T, std::size_t Capacity>
+constexpr typename StaticLinkedList<T, Capacity>::Index StaticLinkedList<T, Capacity>::slotAt(
+    const std::size_t index) const {
+  if (index == this->length - 1u) return this->tail;
+  Index slot = this->head;
+  for (std::size_t position = 0; position < index; ++position) slot = this->links[slot];
+  return slot;
+}
+
+// Unlinks `slot`, whose predecessor is `prior` (none for the head), and
+// pushes it on the free stack.
+template <typename T, std::size_t Capacity>
+constexpr T StaticLinkedList<T, Capacity>::release(Index prior, Index slot) {
+  T data = std::move(this->values[slot]);
+  this->values[slot] = T();
+  Index next = this->links[slot];
+  if (prior == none)
+    this->head = next;
+  else
+    this->links[prior] = next;
+  if (next == none) this->tail = prior;
+  this->links[slot] = this->freeSlot;
+  this->freeSlot = slot;
+  --this->length;
+  return data;
+}
+
+#endif
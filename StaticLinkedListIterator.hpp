@@ -0,0 +1,61 @@
+#ifndef STATICLINKEDLISTITERATOR_HPP
+#define STATICLINKEDLISTITERATOR_HPP
+
+#include <stddef.h>
+#include <iterator>
+#include <type_traits>
+
+// Forward iterator over a StaticLinkedList: a slot index plus the list's
+// value and link arrays. Usable in constant expressions.
+template <typename T, typename Index, bool Const = false>
+class StaticLinkedListIterator {
+ public:
+  using iterator_category = std::forward_iterator_tag;
+  using value_type = T;
+  using difference_type = std::ptrdiff_t;
+  using pointer = typename std::conditional<Const, const T*, T*>::type;
+  using reference = typename std::conditional<Const, const T&, T&>::type;
+
+  constexpr StaticLinkedListIterator() : values(nullptr), links(nullptr), slot(0) {}
+  constexpr StaticLinkedListIterator(pointer values, const Index* links, Index slot)
+      : values(values), links(links), slot(slot) {}
+  template <bool OtherConst, typename = typename std::enable_if<Const && !OtherConst>::type>
+  constexpr StaticLinkedListIterator(const StaticLinkedListIterator<T, Index, OtherConst>& other)
+      : values(other.values), links(other.links), slot(other.slot) {}
+
+  constexpr StaticLinkedListIterator& operator++() {
+    this->slot = this->links[this->slot];
+    return *this;
+  }
+  constexpr StaticLinkedListIterator operator++(int) {
+    StaticLinkedListIterator previous = *this;
+    this->slot = this->links[this->slot];
+    return previous;
+  }
+  constexpr reference operator*() const {
+    return this->values[this->slot];
+  }
+  constexpr pointer operator->() const {
+    return &this->values[this->slot];
+  }
+  template <bool OtherConst>
+  constexpr const bool operator==(
+      const StaticLinkedListIterator<T, Index, OtherConst>& other) const {
+    return this->slot == other.slot;
+  }
+  template <bool OtherConst>
+  constexpr const bool operator!=(
+      const StaticLinkedListIterator<T, Index, OtherConst>& other) const {
+    return this->slot != other.slot;
+  }
+
+ private:
+  template <typename, typename, bool>
+  friend class StaticLinkedListIterator;
+
+  pointer values;
+  const Index* links;
+  Index slot;
+};
+
+#endif
@@ -10,13 +10,39 @@
 #include <cppunit/extensions/TestFactoryRegistry.h>
 #include <cppunit/ui/text/TextTestRunner.h>
 #include <netinet/in.h>
+#include <unistd.h>
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
 #include <iostream>
+#include <iterator>
+#include <limits>
 #include <list>
+#include <memory>
+#include <numeric>
 #include <sstream>
+#include <stdexcept>
 #include <string>
+#include <thread>
+#include <vector>
 
+#include "BlockSearch.hpp"
+#include "CompactLinkedList.hpp"
+#include "ConcurrentLinkedQueue.hpp"
+#include "DoublyLinkedList.hpp"
+#include "IndexedLinkedList.hpp"
+#include "IntrusiveLinkedList.hpp"
 #include "LinkedList.hpp"
+#include "ListStatistics.hpp"
+#include "ListViews.hpp"
+#include "MappedList.hpp"
 #include "Node.hpp"
+#include "PersistentList.hpp"
+#include "SkipList.hpp"
+#include "SlabAllocator.hpp"
+#include "SmallLinkedList.hpp"
+#include "StaticLinkedList.hpp"
+#include "UnrolledLinkedList.hpp"
 
 using namespace CppUnit;
 using namespace std;
@@ -28,6 +54,7 @@ class TestLists : public CppUnit::TestFixture {
   CPPUNIT_TEST(testNodeConstructor);
   CPPUNIT_TEST(testLinkedListEquality);
   CPPUNIT_TEST(testLinkedListIsEmpty);
+  CPPUNIT_TEST(testLinkedListContains);
   CPPUNIT_TEST(testLinkedListGetHead);
   CPPUNIT_TEST(testLinkedListSize);
   CPPUNIT_TEST(testLinkedListAppend);
@@ -37,12 +64,40 @@ class TestLists : public CppUnit::TestFixture {
   CPPUNIT_TEST(testLinkedListAccess);
   CPPUNIT_TEST(testLinkedListRemoveSingle);
   CPPUNIT_TEST(testLinkedListRemoveMultiple);
+  CPPUNIT_TEST(testLinkedListCopyAndMove);
+  CPPUNIT_TEST(testLinkedListEmplace);
+  CPPUNIT_TEST(testLinkedListIndexedLoop);
+  CPPUNIT_TEST(testLinkedListSplice);
+  CPPUNIT_TEST(testLinkedListSplitAt);
+  CPPUNIT_TEST(testLinkedListIterators);
+  CPPUNIT_TEST(testLinkedListSort);
+  CPPUNIT_TEST(testLinkedListRanges);
+  CPPUNIT_TEST(testLinkedListPrefetching);
+  CPPUNIT_TEST(testLinkedListRelayout);
+  CPPUNIT_TEST(testLinkedListParallel);
+  CPPUNIT_TEST(testLinkedListStatistics);
+  CPPUNIT_TEST(testLinkedListSlabAllocator);
+  CPPUNIT_TEST(testSmallLinkedList);
+  CPPUNIT_TEST(testUnrolledLinkedList);
+  CPPUNIT_TEST(testDoublyLinkedList);
+  CPPUNIT_TEST(testConcurrentLinkedQueue);
+  CPPUNIT_TEST(testConcurrentLinkedQueueStress);
+  CPPUNIT_TEST(testSkipList);
+  CPPUNIT_TEST(testIndexedLinkedList);
+  CPPUNIT_TEST(testIntrusiveLinkedList);
+  CPPUNIT_TEST(testCompactLinkedList);
+  CPPUNIT_TEST(testBlockSearch);
+  CPPUNIT_TEST(testListFiles);
+  CPPUNIT_TEST(testPersistentList);
+  CPPUNIT_TEST(testStaticLinkedList);
+  CPPUNIT_TEST(testListViews);
   CPPUNIT_TEST_SUITE_END();
 
  protected:
   void testNodeConstructor(void);
   void testLinkedListEquality(void);
   void testLinkedListIsEmpty(void);
+  void testLinkedListContains(void);
   void testLinkedListGetHead(void);
   void testLinkedListSize(void);
   void testLinkedListAppend(void);
@@ -52,10 +107,62 @@ class TestLists : public CppUnit::TestFixture {
   void testLinkedListAccess(void);
   void testLinkedListRemoveSingle(void);
   void testLinkedListRemoveMultiple(void);
+  void testLinkedListCopyAndMove(void);
+  void testLinkedListEmplace(void);
+  void testLinkedListIndexedLoop(void);
+  void testLinkedListSplice(void);
+  void testLinkedListSplitAt(void);
+  void testLinkedListIterators(void);
+  void testLinkedListSort(void);
+  void testLinkedListRanges(void);
+  void testLinkedListPrefetching(void);
+  void testLinkedListRelayout(void);
+  void testLinkedListParallel(void);
+  void testLinkedListStatistics(void);
+  void testLinkedListSlabAllocator(void);
+  void testSmallLinkedList(void);
+  void testUnrolledLinkedList(void);
+  void testDoublyLinkedList(void);
+  void testConcurrentLinkedQueue(void);
+  void testConcurrentLinkedQueueStress(void);
+  void testSkipList(void);
+  void testIndexedLinkedList(void);
+  void testIntrusiveLinkedList(void);
+  void testCompactLinkedList(void);
+  void testBlockSearch(void);
+  void testListFiles(void);
+  void testPersistentList(void);
+  void testStaticLinkedList(void);
+  void testListViews(void);
 };
 
 //-----------------------------------------------------------------------------
 
+// Builds, changes and sums a StaticLinkedList during constant evaluation.
+constexpr int staticListSum() {
+  StaticLinkedList<int, 8> list({1, 2, 3});
+  list.prepend(0).insert(9, 2);
+  list.remove(3);
+  list.append(4);
+  list.unprepend();
+  list[0] += 10;
+  int sum = 0;
+  for (int data : list) sum += data;
+  return sum;
+}
+
+// A pipeline stage written as a coroutine: squares of the even elements.
+ListGenerator<int> evenSquares(const LinkedList<int>& list) {
+  for (int data : list)
+    if (data % 2 == 0) co_yield data * data;
+}
+
+// Yields `count` elements, then fails.
+ListGenerator<int> failAfter(const int count) {
+  for (int data = 0; data < count; ++data) co_yield data;
+  throw std::runtime_error("generator failed");
+}
+
 void TestLists::testNodeConstructor(void) {
   Node<int> a(1);
   Node<string> b("A");
@@ -102,6 +209,15 @@ void TestLists::testLinkedListIsEmpty(void) {
   CPPUNIT_ASSERT(!LinkedList<int>({1, 2}).isEmpty());
 }
 
+void TestLists::testLinkedListContains(void) {
+  CPPUNIT_ASSERT(!LinkedList<int>().contains(1));
+  CPPUNIT_ASSERT(LinkedList<int>(1).contains(1));
+  CPPUNIT_ASSERT(LinkedList<int>({1, 2, 3}).contains(3));
+  CPPUNIT_ASSERT(!LinkedList<int>({1, 2, 3}).contains(4));
+  CPPUNIT_ASSERT(LinkedList<string>({"A", "B"}).contains("B"));
+  CPPUNIT_ASSERT(!LinkedList<string>({"A", "B"}).contains("C"));
+}
+
 void TestLists::testLinkedListGetHead(void) {
   CPPUNIT_ASSERT(1 == LinkedList<int>(1).getHead());
   CPPUNIT_ASSERT_THROW(LinkedList<int>().getHead(), exception);
@@ -256,6 +372,1341 @@ void TestLists::testLinkedListRemoveMultiple(void) {
   CPPUNIT_ASSERT(LinkedList<string>({}) == b.remove(" ", 1));
 }
 
+void TestLists::testLinkedListCopyAndMove(void) {
+  LinkedList<string> a({"A", "B", "C"});
+  LinkedList<string> b(a);
+  CPPUNIT_ASSERT(a == b);
+  b.append("D");
+  CPPUNIT_ASSERT(LinkedList<string>({"A", "B", "C"}) == a);
+  LinkedList<string> c(std::move(b));
+  CPPUNIT_ASSERT(LinkedList<string>({"A", "B", "C", "D"}) == c);
+  CPPUNIT_ASSERT(b.isEmpty() && 0 == b.size());
+  b = c;
+  CPPUNIT_ASSERT(b == c);
+  c = std::move(a);
+  CPPUNIT_ASSERT(LinkedList<string>({"A", "B", "C"}) == c);
+  CPPUNIT_ASSERT(a.isEmpty());
+  a = a;
+  c = LinkedList<string>("E");
+  CPPUNIT_ASSERT(LinkedList<string>("E") == c);
+
+  // Allocators from different arenas cannot free each other's nodes, so move
+  // assignment must fall back to moving the elements.
+  LinkedList<string, SlabAllocator<string>> d({"A", "B"});
+  LinkedList<string, SlabAllocator<string>> e;
+  e = std::move(d);
+  CPPUNIT_ASSERT((LinkedList<string, SlabAllocator<string>>({"A", "B"}) == e));
+  CPPUNIT_ASSERT(d.isEmpty());
+}
+
+void TestLists::testLinkedListEmplace(void) {
+  LinkedList<std::unique_ptr<int>> a;
+  a.append(std::unique_ptr<int>(new int(2)));
+  a.prepend(std::unique_ptr<int>(new int(0)));
+  a.insert(std::unique_ptr<int>(new int(1)), 1);
+  a.emplaceBack(new int(3)).emplaceFront(new int(-1)).emplace(5, new int(4));
+  CPPUNIT_ASSERT(6 == a.size());
+  for (std::size_t i = 0; i < a.size(); ++i) CPPUNIT_ASSERT(int(i) - 1 == *a[i]);
+  std::unique_ptr<int> b = a.unprepend();
+  CPPUNIT_ASSERT(-1 == *b);
+  b = a.unappend();
+  CPPUNIT_ASSERT(4 == *b);
+  b = a.remove(1);
+  CPPUNIT_ASSERT(1 == *b);
+  LinkedList<std::unique_ptr<int>> c(std::move(a));
+  CPPUNIT_ASSERT(3 == c.size() && a.isEmpty());
+  LinkedList<string> d;
+  d.emplaceBack(3, 'A').emplaceFront("B").emplace(1, "C");
+  CPPUNIT_ASSERT(LinkedList<string>({"B", "C", "AAA"}) == d);
+}
+
+// Indexed access resumes from the last position reached, so interleave it
+// with every kind of mutation and check it against a vector.
+void TestLists::testLinkedListIndexedLoop(void) {
+  LinkedList<int> a;
+  std::vector<int> expected;
+  unsigned int seed = 11;
+  for (int i = 0; i < 3000; ++i) {
+    seed = seed * 1103515245 + 12345;
+    std::size_t index = expected.empty() ? 0 : (seed >> 8) % expected.size();
+    switch ((seed >> 4) % 8) {
+      case 0:
+        a.prepend(i);
+        expected.insert(expected.begin(), i);
+        break;
+      case 1:
+        a.append(i);
+        expected.push_back(i);
+        break;
+      case 2:
+        if (expected.empty()) break;
+        CPPUNIT_ASSERT(expected.front() == a.unprepend());
+        expected.erase(expected.begin());
+        break;
+      case 3:
+        if (expected.empty()) break;
+        CPPUNIT_ASSERT(expected.back() == a.unappend());
+        expected.pop_back();
+        break;
+      case 4:
+        if (expected.empty()) break;
+        CPPUNIT_ASSERT(expected[index] == a.remove(index));
+        expected.erase(expected.begin() + index);
+        break;
+      case 5:
+        a.insert(i, index);
+        expected.insert(expected.begin() + index, i);
+        break;
+      default:
+        for (std::size_t j = index; j < expected.size() && j < index + 5; ++j)
+          CPPUNIT_ASSERT(expected[j] == a[j]);
+    }
+  }
+  for (std::size_t i = 0; i < expected.size(); ++i) CPPUNIT_ASSERT(expected[i] == a[i]);
+  for (std::size_t i = 0; i < expected.size(); ++i) a.insert(-1, 2 * i);
+  for (std::size_t i = 0; i < expected.size(); ++i) CPPUNIT_ASSERT(-1 == a.remove(i));
+  for (std::size_t i = 0; i < expected.size(); ++i) CPPUNIT_ASSERT(expected[i] == a[i]);
+  a.remove(expected[0], 1);
+  CPPUNIT_ASSERT(expected[1] == a[0]);
+}
+
+void TestLists::testLinkedListSplice(void) {
+  LinkedList<int> a({1, 2});
+  LinkedList<int> b({3, 4});
+  CPPUNIT_ASSERT(LinkedList<int>({1, 2, 3, 4}) == a.splice(std::move(b)));
+  CPPUNIT_ASSERT(b.isEmpty() && 4 == a.size() && 4 == a.getTail());
+  CPPUNIT_ASSERT(LinkedList<int>({0, 1, 2, 3, 4}) == a.splice(0, LinkedList<int>(0)));
+  CPPUNIT_ASSERT(LinkedList<int>({0, 1, 9, 8, 2, 3, 4}) == a.splice(2, LinkedList<int>({9, 8})));
+  CPPUNIT_ASSERT(LinkedList<int>({0, 1, 9, 8, 2, 3, 4}) == a.splice(3, LinkedList<int>()));
+  CPPUNIT_ASSERT_THROW(a.splice(8, LinkedList<int>(1)), exception);
+  CPPUNIT_ASSERT(9 == a[2]);
+  a.append(5);
+  CPPUNIT_ASSERT(5 == a.getTail() && 8 == a.size());
+
+  LinkedList<int> c({1, 2, 3, 4, 5});
+  LinkedList<int> d;
+  LinkedListIterator<int> first = c.begin();
+  ++first;
+  LinkedListIterator<int> last = first;
+  ++last;
+  ++last;
+  CPPUNIT_ASSERT(LinkedList<int>({2, 3}) == d.splice(c, first, last));
+  CPPUNIT_ASSERT(LinkedList<int>({1, 4, 5}) == c);
+  CPPUNIT_ASSERT(LinkedList<int>({2, 3, 4, 5}) ==
+                 d.splice(c, ++c.begin(), c.end()));
+  CPPUNIT_ASSERT(LinkedList<int>(1) == c && 1 == c.getTail());
+  CPPUNIT_ASSERT(LinkedList<int>({2, 3, 4, 5, 1}) ==
+                 d.splice(c, c.begin(), c.end()));
+  CPPUNIT_ASSERT(c.isEmpty());
+  c.append(6);
+  CPPUNIT_ASSERT(LinkedList<int>(6) == c);
+
+  LinkedList<string, SlabAllocator<string>> e({"A"});
+  LinkedList<string, SlabAllocator<string>> f({"B", "C"});
+  e.splice(std::move(f));
+  CPPUNIT_ASSERT((LinkedList<string, SlabAllocator<string>>({"A", "B", "C"}) == e));
+  CPPUNIT_ASSERT(f.isEmpty());
+}
+
+void TestLists::testLinkedListSplitAt(void) {
+  LinkedList<int> a({1, 2, 3, 4, 5});
+  LinkedList<int> b = a.splitAt(2);
+  CPPUNIT_ASSERT(LinkedList<int>({1, 2}) == a && 2 == a.getTail());
+  CPPUNIT_ASSERT(LinkedList<int>({3, 4, 5}) == b && 5 == b.getTail());
+  CPPUNIT_ASSERT(LinkedList<int>() == a.splitAt(2));
+  CPPUNIT_ASSERT_THROW(a.splitAt(3), exception);
+  LinkedList<int> c = a.splitAt(0);
+  CPPUNIT_ASSERT(a.isEmpty() && LinkedList<int>({1, 2}) == c);
+  a.append(7);
+  CPPUNIT_ASSERT(LinkedList<int>(7) == a);
+  c.splice(std::move(b));
+  CPPUNIT_ASSERT(LinkedList<int>({1, 2, 3, 4, 5}) == c);
+  CPPUNIT_ASSERT(3 == c[2]);
+  LinkedList<int> d = c.splitAt(1);
+  CPPUNIT_ASSERT(2 == d[0] && 5 == d[3] && 1 == c[0]);
+}
+
+void TestLists::testLinkedListIterators(void) {
+  static_assert(is_same<iterator_traits<LinkedList<int>::iterator>::iterator_category,
+                        forward_iterator_tag>::value, "forward iterator");
+  static_assert(is_same<LinkedList<int>::const_iterator::reference, const int&>::value,
+                "const_iterator is read-only");
+
+  LinkedList<int> a({1, 2, 3, 4});
+  int sum = 0;
+  for (int data : a) sum += data;
+  CPPUNIT_ASSERT(10 == sum);
+  CPPUNIT_ASSERT(10 == accumulate(a.cbegin(), a.cend(), 0));
+  CPPUNIT_ASSERT(4 == distance(a.begin(), a.end()));
+  CPPUNIT_ASSERT(3 == *find(a.begin(), a.end(), 3));
+  CPPUNIT_ASSERT(a.end() == find(a.begin(), a.end(), 5));
+  CPPUNIT_ASSERT(LinkedList<int>().begin() == LinkedList<int>().end());
+
+  vector<int> copied;
+  copy(a.begin(), a.end(), back_inserter(copied));
+  CPPUNIT_ASSERT((vector<int>{1, 2, 3, 4}) == copied);
+
+  LinkedList<int>::iterator it = a.begin();
+  CPPUNIT_ASSERT(1 == *it++ && 2 == *it);
+  *it = 7;
+  LinkedList<int>::const_iterator constIt = it;
+  CPPUNIT_ASSERT(constIt == it && 7 == *constIt && 7 == a[1]);
+  for (int& data : a) data *= 2;
+  CPPUNIT_ASSERT(LinkedList<int>({2, 14, 6, 8}) == a);
+
+  const LinkedList<string> b({"AB", "C"});
+  CPPUNIT_ASSERT(2 == b.begin()->size());
+  CPPUNIT_ASSERT("ABC" == accumulate(b.begin(), b.end(), string()));
+}
+
+void TestLists::testLinkedListSort(void) {
+  CPPUNIT_ASSERT(LinkedList<int>().sort().isEmpty());
+  CPPUNIT_ASSERT(LinkedList<int>(1) == LinkedList<int>(1).sort());
+  LinkedList<int> a({5, 3, 9, 1, 3, 7, 2});
+  CPPUNIT_ASSERT(LinkedList<int>({1, 2, 3, 3, 5, 7, 9}) == a.sort());
+  CPPUNIT_ASSERT(9 == a.getTail() && 7 == a.size());
+  a.append(4);
+  CPPUNIT_ASSERT(LinkedList<int>({9, 7, 5, 4, 3, 3, 2, 1}) == a.sort(greater<int>()));
+  CPPUNIT_ASSERT(1 == a.getTail() && 4 == a[3]);
+
+  // Stable: equal keys keep their original order.
+  LinkedList<pair<int, char>> b({{2, 'a'}, {1, 'b'}, {2, 'c'}, {1, 'd'}, {0, 'e'}});
+  b.sort([](const pair<int, char>& x, const pair<int, char>& y) { return x.first < y.first; });
+  CPPUNIT_ASSERT((LinkedList<pair<int, char>>({{0, 'e'}, {1, 'b'}, {1, 'd'}, {2, 'a'}, {2, 'c'}}) ==
+                  b));
+
+  vector<int> expected;
+  LinkedList<int> c;
+  unsigned int seed = 7;
+  for (int i = 0; i < 1000; ++i) {
+    seed = seed * 1103515245 + 12345;
+    expected.push_back(seed % 100);
+    c.append(seed % 100);
+  }
+  std::sort(expected.begin(), expected.end());
+  c.sort();
+  CPPUNIT_ASSERT(std::equal(expected.begin(), expected.end(), c.begin(), c.end()));
+
+  LinkedList<int> d({1, 4, 6});
+  CPPUNIT_ASSERT(LinkedList<int>({0, 1, 2, 4, 4, 6, 8}) == d.merge(LinkedList<int>({0, 2, 4, 8})));
+  CPPUNIT_ASSERT(8 == d.getTail() && 7 == d.size());
+  CPPUNIT_ASSERT(LinkedList<int>({0, 1, 2, 4, 6, 8}) == d.unique());
+  CPPUNIT_ASSERT(8 == d.getTail() && 6 == d.size());
+  LinkedList<int> e({3, 3, 3});
+  CPPUNIT_ASSERT(LinkedList<int>(3) == e.unique() && 3 == e.getTail());
+  CPPUNIT_ASSERT(LinkedList<int>({3, 5}) == e.merge(LinkedList<int>(5)));
+  CPPUNIT_ASSERT(LinkedList<int>({3, 5}) == e.merge(LinkedList<int>()));
+
+  LinkedList<string, SlabAllocator<string>> f({"A", "C"});
+  LinkedList<string, SlabAllocator<string>> g({"B", "D"});
+  f.merge(std::move(g));
+  CPPUNIT_ASSERT(g.isEmpty() && 4 == f.size() && "D" == f.getTail() && "B" == f[1]);
+}
+
+// Element whose copies start failing once a shared budget runs out.
+struct FragileCopy {
+  static int budget;
+  int value;
+  FragileCopy(const int value) : value(value) {}
+  FragileCopy(const FragileCopy& other) : value(other.value) {
+    if (budget-- == 0) throw std::runtime_error("copy failed");
+  }
+  bool operator==(const FragileCopy& other) const { return this->value == other.value; }
+  bool operator!=(const FragileCopy& other) const { return this->value != other.value; }
+};
+
+int FragileCopy::budget = -1;
+
+void TestLists::testLinkedListRanges(void) {
+  const vector<int> values({1, 2, 3, 4, 5});
+  LinkedList<int> a(values.begin(), values.end());
+  CPPUNIT_ASSERT(LinkedList<int>({1, 2, 3, 4, 5}) == a && 5 == a.getTail());
+  a.prependRange(values.begin(), values.begin() + 2).appendRange(values.end() - 2, values.end());
+  a.insertRange(3, values.begin() + 2, values.begin() + 3);
+  CPPUNIT_ASSERT(LinkedList<int>({1, 2, 1, 3, 2, 3, 4, 5, 4, 5}) == a && 10 == a.size());
+  CPPUNIT_ASSERT(5 == a.getTail() && 1 == a.getHead());
+  a.insertRange(10, values.begin(), values.begin() + 1).appendRange(values.end(), values.end());
+  CPPUNIT_ASSERT(1 == a.getTail() && 11 == a.size());
+  CPPUNIT_ASSERT_THROW(a.insertRange(12, values.begin(), values.end()), ListIndexOutOfBounds);
+
+  // Single-pass input ranges work too.
+  std::stringstream input("7 8 9");
+  LinkedList<int> b;
+  b.appendRange(std::istream_iterator<int>(input), std::istream_iterator<int>());
+  const int raw[] = {6};
+  b.prependRange(std::begin(raw), std::end(raw));
+  CPPUNIT_ASSERT(LinkedList<int>({6, 7, 8, 9}) == b && 9 == b.getTail());
+
+  // A failing copy leaves the list as it was.
+  LinkedList<FragileCopy> c({1, 2});
+  const vector<FragileCopy> fragile({3, 4, 5});
+  FragileCopy::budget = 2;
+  CPPUNIT_ASSERT_THROW(c.appendRange(fragile.begin(), fragile.end()), std::runtime_error);
+  FragileCopy::budget = -1;
+  CPPUNIT_ASSERT(LinkedList<FragileCopy>({1, 2}) == c && 2 == c.getTail().value);
+
+  // SlabAllocator serves a forward range from one slab, in address order.
+  vector<int> many(10);
+  std::iota(many.begin(), many.end(), 0);
+  LinkedList<int, SlabAllocator<int, 4>> d(many.begin(), many.end());
+  for (int i = 0; i < 9; ++i)
+    CPPUNIT_ASSERT(reinterpret_cast<const char*>(&d[i + 1]) -
+                       reinterpret_cast<const char*>(&d[i]) ==
+                   sizeof(Node<int>));
+  CPPUNIT_ASSERT(10 == d.size() && 9 == d.getTail());
+}
+
+void TestLists::testLinkedListPrefetching(void) {
+  // Long enough for several groups of warmed segments.
+  vector<int> values(5000);
+  std::iota(values.begin(), values.end(), 0);
+  LinkedList<int> a(values.begin(), values.end());
+  LinkedList<int> plain(a);
+  CPPUNIT_ASSERT(!a.isPrefetching() && a.setPrefetching(true).isPrefetching());
+  CPPUNIT_ASSERT(a.contains(4999) && a.contains(0) && !a.contains(5000) && a == plain);
+  int64_t total = 0;
+  a.forEach([&total](const int data) { total += data; });
+  CPPUNIT_ASSERT(12497500 == total);
+  std::stringstream printed, expected;
+  printed << a;
+  expected << plain;
+  CPPUNIT_ASSERT(expected.str() == printed.str());
+
+  // Nodes added anywhere keep the jump pointers usable; removed or relinked
+  // ones make the list take new ones.
+  for (int i = 0; i < 100; ++i) a.prepend(-1 - i).insert(7, 2500);
+  vector<int> seen;
+  a.forEach([&seen](int& data) { seen.push_back(data++); });
+  CPPUNIT_ASSERT(5200 == seen.size() && -100 == seen[0] && 7 == seen[2500] && 4999 == seen.back());
+  CPPUNIT_ASSERT(vector<int>(a.begin(), a.end()) != seen);
+  a.forEach([](int& data) { --data; });
+  CPPUNIT_ASSERT(vector<int>(a.begin(), a.end()) == seen);
+  a.remove(7, 100).sort();
+  for (int i = 0; i < 100; ++i) a.unprepend();
+  CPPUNIT_ASSERT(a == plain && a.contains(4999));
+  LinkedList<int> rest = a.splitAt(2500);
+  CPPUNIT_ASSERT(2500 == a.size() && 2499 == a.getTail() && !a.contains(2500));
+  CPPUNIT_ASSERT(!rest.isPrefetching() && 2500 == rest.getHead());
+  a.splice(std::move(rest));
+  CPPUNIT_ASSERT(a == plain && a.contains(4999));
+
+  // Copies keep the mode and moves take it along.
+  LinkedList<int> b(a);
+  LinkedList<int> c(std::move(a));
+  CPPUNIT_ASSERT(b.isPrefetching() && c.isPrefetching() && b == c && c == plain);
+  CPPUNIT_ASSERT(!c.setPrefetching(false).isPrefetching() && c.contains(4999));
+}
+
+void TestLists::testLinkedListRelayout(void) {
+  // Whether the elements of `list` sit in consecutive nodes, in list order.
+  auto contiguous = [](const LinkedList<string>& list) {
+    const string* previous = nullptr;
+    for (const string& data : list) {
+      if (previous && reinterpret_cast<const char*>(&data) !=
+                          reinterpret_cast<const char*>(previous) + sizeof(Node<string>))
+        return false;
+      previous = &data;
+    }
+    return true;
+  };
+
+  LinkedList<string> a;
+  for (int i = 0; i < 200; ++i) a.insert(std::to_string(i), i % 2 ? 0 : a.size());
+  const LinkedList<string> expected(a);
+  CPPUNIT_ASSERT(!contiguous(a) && "199" == a[0]);
+  a.relayout();
+  CPPUNIT_ASSERT(contiguous(a) && a == expected && "199" == a.getHead() && "198" == a.getTail());
+  CPPUNIT_ASSERT("101" == a[49] && "99" == a[50]);
+  // Removed nodes go back to the block; the rest stay where they are.
+  a.remove(100);
+  a.unprepend();
+  CPPUNIT_ASSERT(!contiguous(a) && 198 == a.size() && "197" == a.getHead());
+  a.insert("X", 50).append("Y");
+  CPPUNIT_ASSERT(!contiguous(a) && a.relayout().size() == 200 && contiguous(a));
+  CPPUNIT_ASSERT("X" == a[50] && "Y" == a.getTail());
+
+  // An incremental pass moves a bounded number of nodes per call, and the
+  // list stays usable and changeable in between.
+  LinkedList<string> b(expected);
+  CPPUNIT_ASSERT(!b.relayout(50) && b == expected);
+  b.append("Z").prepend("W");
+  CPPUNIT_ASSERT(!b.relayout(50) && "W" == b.getHead());
+  CPPUNIT_ASSERT(!b.relayout(50) && b.relayout(50));
+  CPPUNIT_ASSERT("Z" == b.getTail() && 202 == b.size() && !contiguous(b));
+  b.unprepend();
+  b.unappend();
+  CPPUNIT_ASSERT(b == expected && contiguous(b));
+  CPPUNIT_ASSERT(!b.relayout(10) && "197" == b.remove(1) && !b.relayout(10));
+  b.remove(9);
+  CPPUNIT_ASSERT(!b.relayout(10) && 198 == b.size());
+  b.relayout();
+  CPPUNIT_ASSERT(contiguous(b) && "199" == b.getHead() && "198" == b.getTail());
+  LinkedList<string> empty;
+  CPPUNIT_ASSERT(empty.relayout(1) && empty.relayout().isEmpty());
+
+  // Relaid-out nodes handed to other lists stay valid until the last holder
+  // destroys them.
+  LinkedList<string>* c = new LinkedList<string>(expected);
+  c->relayout(120);
+  LinkedList<string> rest = c->splitAt(100);
+  LinkedList<string> moved(std::move(*c));
+  delete c;
+  CPPUNIT_ASSERT(100 == moved.size() && 100 == rest.size() && contiguous(moved));
+  moved.splice(std::move(rest));
+  CPPUNIT_ASSERT(moved == expected);
+  moved.sort();
+  CPPUNIT_ASSERT("0" == moved.getHead() && "99" == moved.getTail());
+
+  // A move takes a pass in progress along.
+  static_assert(std::is_nothrow_move_constructible<LinkedList<string>>::value, "");
+  LinkedList<string> e(expected);
+  CPPUNIT_ASSERT(!e.relayout(50));
+  LinkedList<string> f(std::move(e));
+  CPPUNIT_ASSERT(e.isEmpty() && e.relayout(50) && !f.relayout(50) && !f.relayout(50));
+  CPPUNIT_ASSERT(f.relayout(50) && contiguous(f) && f == expected);
+
+  // Relocating is not an allocation as far as the statistics go.
+  LinkedList<int, std::allocator<int>, ListStatistics> d({3, 1, 2});
+  const std::size_t bytes = d.getStatistics().getLiveBytes();
+  d.relayout().append(4);
+  CPPUNIT_ASSERT(4 == d.getStatistics().getAllocations());
+  CPPUNIT_ASSERT(4 * bytes / 3 == d.getStatistics().getLiveBytes());
+  CPPUNIT_ASSERT((LinkedList<int, std::allocator<int>, ListStatistics>({3, 1, 2, 4}) == d));
+}
+
+void TestLists::testLinkedListParallel(void) {
+  ThreadPool pool(3);
+  LinkedList<int> a;
+  for (int i = 0; i < 10001; ++i) a.append(i);
+  a.parallelForEach([](int& data) { data *= 2; }, pool);
+  CPPUNIT_ASSERT(20000 == a.getTail() && 2 == a[1] && 10001 == a.size());
+  CPPUNIT_ASSERT(100010000 == a.parallelReduce(0, std::plus<int>(), pool));
+  CPPUNIT_ASSERT(100010007 == a.parallelReduce(7, std::plus<int>()));
+
+  LinkedList<string> b = a.parallelTransform([](const int data) { return std::to_string(data); },
+                                              pool);
+  CPPUNIT_ASSERT(10001 == b.size() && "0" == b.getHead() && "20000" == b.getTail());
+  string serial = ">";
+  for (const string& data : b) serial += data;
+  CPPUNIT_ASSERT(serial == b.parallelReduce(">", std::plus<string>(), pool));
+
+  CPPUNIT_ASSERT_THROW(a.parallelForEach(
+                           [](const int data) {
+                             if (data == 9000) throw std::runtime_error("stop");
+                           },
+                           pool),
+                       exception);
+
+  // Each element's traversal runs on the pool its own traversal is using.
+  LinkedList<LinkedList<int>> nested;
+  for (int i = 0; i < 8; ++i) nested.append(a);
+  LinkedList<int> sums =
+      nested.parallelTransform([&pool](const LinkedList<int>& list) {
+        return list.parallelReduce(0, std::plus<int>(), pool);
+      },
+                               pool);
+  CPPUNIT_ASSERT(8 == sums.size() && 100010000 == sums.getHead() && 100010000 == sums.getTail());
+
+  ThreadPool callerOnly(0);
+  LinkedList<int> empty;
+  CPPUNIT_ASSERT(5 == empty.parallelReduce(5, std::plus<int>(), callerOnly));
+  CPPUNIT_ASSERT(empty.parallelTransform([](const int data) { return data; }, pool).isEmpty());
+  CPPUNIT_ASSERT(20000 == a.parallelReduce(0, [](int x, int y) { return std::max(x, y); },
+                                           callerOnly));
+  CPPUNIT_ASSERT(6 == LinkedList<int>({1, 2, 3}).parallelReduce(0, std::plus<int>(), pool));
+}
+
+void TestLists::testLinkedListStatistics(void) {
+  using CountedList = LinkedList<int, std::allocator<int>, ListStatistics>;
+  const std::size_t node = sizeof(Node<int>);
+  CountedList a({1, 2, 3, 4, 5});
+  const ListStatistics& stats = a.getStatistics();
+  CPPUNIT_ASSERT(5 == stats.getAllocations() && 0 == stats.getFrees());
+  CPPUNIT_ASSERT(5 * node == stats.getLiveBytes());
+
+  // Each unappend walks to the node before the tail.
+  a.unappend();
+  a.unappend();
+  CPPUNIT_ASSERT(2 == stats.getWalks(ListWalk::Unappend));
+  CPPUNIT_ASSERT(5 == stats.getNodesWalked(ListWalk::Unappend));
+  CPPUNIT_ASSERT(3 == stats.getLongestWalk(ListWalk::Unappend));
+  CPPUNIT_ASSERT(2 == stats.getWalkLengths(ListWalk::Unappend, 2));
+  CPPUNIT_ASSERT(2 == stats.getFrees() && 3 * node == stats.getLiveBytes());
+  CPPUNIT_ASSERT(5 * node == stats.getPeakBytes());
+  const CountedList& view = a;
+  CPPUNIT_ASSERT(1 == view[0] && 2 == view[1] && 3 == view[2]);
+  CPPUNIT_ASSERT(3 == stats.getWalks(ListWalk::Access));
+  CPPUNIT_ASSERT(1 == stats.getNodesWalked(ListWalk::Access));
+  CPPUNIT_ASSERT(2 == stats.getWalkLengths(ListWalk::Access, 0));
+  CPPUNIT_ASSERT(0 == stats.getWalks(ListWalk::Insert) && 0 == stats.getWalks(ListWalk::Remove));
+
+  // Nodes moved between lists move their bytes, not their allocations.
+  CountedList b = a.splitAt(1);
+  CountedList c(std::move(b));
+  CPPUNIT_ASSERT(node == stats.getLiveBytes() && 2 * node == c.getStatistics().getLiveBytes());
+  CPPUNIT_ASSERT(0 == b.getStatistics().getLiveBytes() && 0 == c.getStatistics().getAllocations());
+  a.splice(std::move(c));
+  CPPUNIT_ASSERT(3 * node == stats.getLiveBytes() && 0 == c.getStatistics().getLiveBytes());
+  CountedList d(a);
+  CPPUNIT_ASSERT(3 == d.getStatistics().getAllocations() && 1 == stats.getWalks(ListWalk::Split));
+
+  a.getStatistics().reset();
+  a.clear();
+  CPPUNIT_ASSERT(0 == stats.getAllocations() && 3 == stats.getFrees() && 0 == stats.getLiveBytes());
+  CPPUNIT_ASSERT(0 == stats.getWalks(ListWalk::Unappend) && 3 * node == stats.getPeakBytes());
+
+  for (int i = 0; i < 12; ++i) d.append(i);
+  d.remove(9);
+  d.insert(7, 2);
+  std::stringstream output;
+  d.getStatistics().dump(output);
+  std::stringstream expected;
+  expected << "allocations 16, frees 1, live bytes " << 15 * node << ", peak bytes " << 15 * node
+           << "\ninsert: 1 walks, 1 nodes, longest 1, lengths 1:1"
+           << "\nremove: 1 walks, 8 nodes, longest 8, lengths 8-15:1\n";
+  CPPUNIT_ASSERT(expected.str() == output.str());
+}
+
+void TestLists::testLinkedListSlabAllocator(void) {
+  SlabPool pool(sizeof(int), alignof(int), 2);
+  void* x = pool.allocate();
+  void* y = pool.allocate();
+  void* z = pool.allocate();
+  CPPUNIT_ASSERT(x != y && y != z && x != z);
+  pool.deallocate(y);
+  CPPUNIT_ASSERT(y == pool.allocate());
+  pool.deallocate(x);
+  pool.deallocate(z);
+  // Reserved blocks queue behind the free ones, in address order.
+  pool.reserve(6);
+  CPPUNIT_ASSERT(z == pool.allocate() && x == pool.allocate());
+  CPPUNIT_ASSERT(static_cast<char*>(z) + pool.getBlockSize() == pool.allocate());
+  char* fresh = static_cast<char*>(pool.allocate());
+  CPPUNIT_ASSERT(fresh + pool.getBlockSize() == pool.allocate());
+  void* last = pool.allocate();
+  CPPUNIT_ASSERT(fresh + 2 * pool.getBlockSize() == last);
+  pool.deallocate(last);
+  pool.reserve(3);
+  CPPUNIT_ASSERT(last == pool.allocate());
+  fresh = static_cast<char*>(pool.allocate());
+  CPPUNIT_ASSERT(fresh + pool.getBlockSize() == pool.allocate());
+
+  SlabAllocator<int, 4> allocator;
+  LinkedList<int, SlabAllocator<int, 4>> a(allocator);
+  LinkedList<string, SlabAllocator<string, 4>> b({"A", "B", "C"});
+  CPPUNIT_ASSERT(a.getAllocator() == allocator);
+  for (int i = 0; i < 10; ++i) a.append(i);
+  CPPUNIT_ASSERT(10 == a.size());
+  CPPUNIT_ASSERT(0 == a.unprepend());
+  CPPUNIT_ASSERT(9 == a.unappend());
+  CPPUNIT_ASSERT(5 == a.remove(4));
+  a.prepend(0).append(9).insert(5, 5);
+  for (int i = 0; i < 10; ++i) CPPUNIT_ASSERT(i == a[i]);
+  CPPUNIT_ASSERT("B" == b.remove(1));
+  CPPUNIT_ASSERT((LinkedList<string, SlabAllocator<string, 4>>({"A", "C"}) == b));
+}
+
+void TestLists::testSmallLinkedList(void) {
+  using Small = SmallLinkedList<string, 4>;
+  // The number of elements of `list` stored inside the list object.
+  auto inlined = [](const Small& list) {
+    const char* first = reinterpret_cast<const char*>(&list);
+    std::size_t count = 0;
+    for (const string& data : list) {
+      const char* element = reinterpret_cast<const char*>(&data);
+      if (element >= first && element < first + sizeof(list)) ++count;
+    }
+    return count;
+  };
+
+  Small a({"A", "B", "C"});
+  CPPUNIT_ASSERT(3 == inlined(a) && 4 == Small::inlineCapacity());
+  a.append("D").append("E").prepend("Z");
+  CPPUNIT_ASSERT(6 == a.size() && 4 == inlined(a));
+  CPPUNIT_ASSERT("A" == a.remove(1) && "Z" == a.unprepend());
+  CPPUNIT_ASSERT(3 == inlined(a));
+  // Freed inline slots are reused before the heap.
+  a.append("F").insert("G", 1);
+  CPPUNIT_ASSERT(4 == inlined(a) && (Small({"B", "G", "C", "D", "E", "F"}) == a));
+
+  // Copies and moves keep their own inline nodes.
+  Small b = a;
+  Small c = std::move(a);
+  CPPUNIT_ASSERT(a.isEmpty() && b == c && 4 == inlined(b) && 4 == inlined(c));
+  a = c;
+  c = std::move(b);
+  CPPUNIT_ASSERT(b.isEmpty() && a == c && 4 == inlined(a) && 4 == inlined(c));
+
+  // Splicing and splitting move elements into the receiving list's nodes.
+  Small d({"X"});
+  d.splice(std::move(a));
+  CPPUNIT_ASSERT(a.isEmpty() && 7 == d.size() && "F" == d.getTail() && 4 == inlined(d));
+  Small e = d.splitAt(2);
+  CPPUNIT_ASSERT((Small({"X", "B"}) == d) && 5 == e.size() && 4 == inlined(e));
+  CPPUNIT_ASSERT_THROW(d.splitAt(3), ListIndexOutOfBounds);
+  std::stringstream output;
+  output << d << e;
+  CPPUNIT_ASSERT("[X->B][G->C->D->E->F]" == output.str());
+  e.clear();
+  e.append("H");
+  CPPUNIT_ASSERT(1 == inlined(e));
+
+  SmallLinkedList<int> f({5, 3, 1, 4, 2});
+  f.sort();
+  CPPUNIT_ASSERT(1 == f.getHead() && 5 == f.getTail() && 3 == f[2]);
+
+  // No LinkedList can be made to share a small list's inline nodes: it is not
+  // a LinkedList, and lists built from a LinkedList over inline nodes, split
+  // through a reference to it or copied from it, allocate on the heap.
+  using Inline = LinkedList<int, InlineNodeAllocator<int, Node<int>, 4>>;
+  static_assert(!std::is_convertible<SmallLinkedList<int, 4>*, Inline*>::value,
+                "a SmallLinkedList is not usable as a LinkedList");
+  InlineNodes<Node<int>, 4>* nodes = new InlineNodes<Node<int>, 4>();
+  Inline* source = new Inline(Inline::allocator_type(nodes));
+  source->appendRange(f.begin(), f.end());
+  Inline& base = *source;
+  Inline copy(base);
+  Inline rest = base.splitAt(2);
+  CPPUNIT_ASSERT(2 == base.size() && 2 == base.getTail());
+  CPPUNIT_ASSERT(copy.getAllocator() != base.getAllocator());
+  delete source;
+  delete nodes;
+  CPPUNIT_ASSERT((Inline({1, 2, 3, 4, 5}, copy.getAllocator()) == copy));
+  CPPUNIT_ASSERT(3 == rest.size() && 3 == rest[0] && 5 == rest.getTail());
+}
+
+void TestLists::testUnrolledLinkedList(void) {
+  UnrolledLinkedList<int, 4> a({1, 2, 3, 4, 5, 6, 7, 8, 9});
+  UnrolledLinkedList<string, 2> b;
+  std::stringstream output;
+  output << a;
+  CPPUNIT_ASSERT("[1->2->3->4->5->6->7->8->9]" == output.str());
+  CPPUNIT_ASSERT(9 == a.size());
+  CPPUNIT_ASSERT(1 == a.getHead());
+  CPPUNIT_ASSERT(9 == a.getTail());
+  CPPUNIT_ASSERT(a.contains(5) && !a.contains(10));
+  CPPUNIT_ASSERT_THROW(a[9], exception);
+  CPPUNIT_ASSERT_THROW(a.insert(0, 10), exception);
+  CPPUNIT_ASSERT((a == UnrolledLinkedList<int, 4>(a)));
+  CPPUNIT_ASSERT((a != UnrolledLinkedList<int, 4>({1, 2, 3})));
+  CPPUNIT_ASSERT((UnrolledLinkedList<string, 2>({"B", "C"}) == b.append("C").prepend("B")));
+  CPPUNIT_ASSERT((UnrolledLinkedList<string, 2>({"A", "B", "D", "C"}) ==
+                  b.prepend("A").insert("D", 2)));
+  CPPUNIT_ASSERT("D" == b.remove(2));
+  CPPUNIT_ASSERT("C" == b.unappend());
+  CPPUNIT_ASSERT("A" == b.unprepend());
+  CPPUNIT_ASSERT((UnrolledLinkedList<string, 2>("B") == b));
+  CPPUNIT_ASSERT((UnrolledLinkedList<int, 4>({2, 4, 6, 7, 8, 9}) ==
+                  a.remove(1, 1).remove(3, 1).remove(5, 1)));
+
+  // Mirror a pseudo-random sequence of edits against a vector so node
+  // splitting and merging get exercised at every offset.
+  UnrolledLinkedList<int, 3> c;
+  std::vector<int> expected;
+  unsigned int seed = 7;
+  for (int i = 0; i < 2000; ++i) {
+    seed = seed * 1103515245 + 12345;
+    std::size_t index = expected.empty() ? 0 : (seed >> 8) % (expected.size() + 1);
+    if ((seed >> 4) % 3 || expected.empty()) {
+      c.insert(i, index);
+      expected.insert(expected.begin() + index, i);
+    } else {
+      if (index == expected.size()) --index;
+      CPPUNIT_ASSERT(expected[index] == c.remove(index));
+      expected.erase(expected.begin() + index);
+    }
+  }
+  CPPUNIT_ASSERT(expected.size() == c.size());
+  std::size_t position = 0;
+  for (int data : c) CPPUNIT_ASSERT(expected[position++] == data);
+  for (std::size_t i = 0; i < expected.size(); i += 7) CPPUNIT_ASSERT(expected[i] == c[i]);
+
+  // Every node but the last keeps at least N / 2 elements whatever the mix
+  // of edits, so n elements never take more than 1 + (n - 1) / (N / 2) nodes.
+  UnrolledLinkedList<int, 8> d;
+  expected.clear();
+  for (int i = 0; i < 6000; ++i) {
+    seed = seed * 1103515245 + 12345;
+    const int data = i % 16;
+    const std::size_t index = expected.empty() ? 0 : (seed >> 8) % expected.size();
+    const std::size_t operation = expected.empty() ? 0 : (seed >> 4) % 6;
+    if (operation == 0) {
+      d.prepend(data);
+      expected.insert(expected.begin(), data);
+    } else if (operation == 1) {
+      d.append(data);
+      expected.push_back(data);
+    } else if (operation == 2) {
+      d.insert(data, index);
+      expected.insert(expected.begin() + index, data);
+    } else if (operation == 3) {
+      CPPUNIT_ASSERT(expected[index] == d.remove(index));
+      expected.erase(expected.begin() + index);
+    } else if (operation == 4) {
+      CPPUNIT_ASSERT(expected.front() == d.unprepend());
+      expected.erase(expected.begin());
+    } else {
+      const std::size_t count = 1 + (seed >> 12) % 8;
+      d.remove(data, count);
+      std::size_t removed = 0;
+      for (std::size_t j = 0; j < expected.size();)
+        if (removed < count && expected[j] == data) {
+          expected.erase(expected.begin() + j);
+          ++removed;
+        } else {
+          ++j;
+        }
+    }
+    CPPUNIT_ASSERT(expected.size() == d.size());
+    if (expected.empty())
+      CPPUNIT_ASSERT(0 == d.nodeCount());
+    else
+      CPPUNIT_ASSERT((d.nodeCount() - 1) * 4 < d.size());
+    if (i % 101 == 0) CPPUNIT_ASSERT(std::equal(expected.begin(), expected.end(), d.begin()));
+  }
+  CPPUNIT_ASSERT(std::equal(expected.begin(), expected.end(), d.begin()));
+  UnrolledLinkedList<int, 4> e({1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12});
+  CPPUNIT_ASSERT(3 == e.nodeCount() && 3 == e.remove(4, 1).remove(5, 1).remove(6, 1).nodeCount());
+  CPPUNIT_ASSERT(2 == e.remove(2, 1).remove(3, 1).nodeCount() && 7 == e.size());
+  CPPUNIT_ASSERT(2 == e.prepend(0).nodeCount() && 3 == e.prepend(-1).nodeCount());
+}
+
+void TestLists::testDoublyLinkedList(void) {
+  DoublyLinkedList<int> a({1, 2, 3, 4, 5});
+  DoublyLinkedList<string> b;
+  std::stringstream output;
+  output << a;
+  CPPUNIT_ASSERT("[1<->2<->3<->4<->5]" == output.str());
+  CPPUNIT_ASSERT(a.contains(3) && !a.contains(6));
+  for (std::size_t i = 0; i < a.size(); ++i) CPPUNIT_ASSERT(int(i) + 1 == a[i]);
+  CPPUNIT_ASSERT_THROW(a[5], exception);
+  int expected = 5;
+  for (DoublyLinkedListIterator<int> it = a.end(); it != a.begin();) {
+    --it;
+    CPPUNIT_ASSERT(expected-- == *it);
+  }
+  CPPUNIT_ASSERT(5 == a.unappend());
+  CPPUNIT_ASSERT(4 == a.unappend());
+  CPPUNIT_ASSERT(3 == a.getTail());
+  CPPUNIT_ASSERT(2 == a.remove(1));
+  CPPUNIT_ASSERT(DoublyLinkedList<int>({1, 3}) == a);
+  CPPUNIT_ASSERT(DoublyLinkedList<int>({1, 4, 3}) == a.insert(4, 1));
+  CPPUNIT_ASSERT(DoublyLinkedList<int>({1, 4, 3}) == DoublyLinkedList<int>(a));
+  CPPUNIT_ASSERT(DoublyLinkedList<int>() == a.remove(1, 1).remove(3, 1).remove(4, 1));
+  CPPUNIT_ASSERT_THROW(a.unappend(), exception);
+  CPPUNIT_ASSERT(a.isEmpty());
+  CPPUNIT_ASSERT(DoublyLinkedList<string>({"A", "B"}) == b.append("B").prepend("A"));
+  CPPUNIT_ASSERT("B" == b.unappend());
+  CPPUNIT_ASSERT("A" == b.unappend());
+  CPPUNIT_ASSERT(b.isEmpty());
+  CPPUNIT_ASSERT(DoublyLinkedList<string>("C") == b.append("C"));
+}
+
+void TestLists::testConcurrentLinkedQueue(void) {
+  ConcurrentLinkedQueue<string> a;
+  string b;
+  CPPUNIT_ASSERT(a.isEmpty());
+  CPPUNIT_ASSERT(!a.tryPop(b));
+  a.push("A");
+  a.push(string("B"));
+  CPPUNIT_ASSERT(!a.isEmpty());
+  CPPUNIT_ASSERT(2 == a.size());
+  CPPUNIT_ASSERT(a.tryPop(b) && "A" == b);
+  CPPUNIT_ASSERT(a.tryPop(b) && "B" == b);
+  CPPUNIT_ASSERT(!a.tryPop(b));
+  CPPUNIT_ASSERT(0 == a.size());
+  a.push("C");
+}
+
+// Every pushed value must be popped exactly once, and each consumer must see
+// each producer's values in the order they were pushed.
+void TestLists::testConcurrentLinkedQueueStress(void) {
+  const int producers = 4, consumers = 4, perProducer = 20000;
+  ConcurrentLinkedQueue<int> queue;
+  std::vector<std::vector<int>> popped(consumers);
+  std::atomic<int> remaining(producers * perProducer);
+  std::vector<std::thread> threads;
+  for (int p = 0; p < producers; ++p)
+    threads.emplace_back([&queue, p] {
+      for (int i = 0; i < perProducer; ++i) queue.push(p * perProducer + i);
+    });
+  for (int c = 0; c < consumers; ++c)
+    threads.emplace_back([&queue, &popped, &remaining, c] {
+      int data;
+      while (remaining.load() > 0)
+        if (queue.tryPop(data)) {
+          popped[c].push_back(data);
+          --remaining;
+        } else {
+          std::this_thread::yield();
+        }
+    });
+  for (std::thread& thread : threads) thread.join();
+  std::vector<bool> seen(producers * perProducer, false);
+  for (const std::vector<int>& values : popped) {
+    std::vector<int> last(producers, -1);
+    for (int data : values) {
+      CPPUNIT_ASSERT(!seen[data]);
+      seen[data] = true;
+      CPPUNIT_ASSERT(last[data / perProducer] < data);
+      last[data / perProducer] = data;
+    }
+  }
+  for (bool found : seen) CPPUNIT_ASSERT(found);
+  CPPUNIT_ASSERT(queue.isEmpty());
+}
+
+void TestLists::testSkipList(void) {
+  SkipList<string> a({"A", "B", "C"});
+  std::stringstream output;
+  output << a;
+  CPPUNIT_ASSERT("[A->B->C]" == output.str());
+  CPPUNIT_ASSERT("A" == a.getHead() && "C" == a.getTail());
+  CPPUNIT_ASSERT(a.contains("B") && !a.contains("D"));
+  CPPUNIT_ASSERT_THROW(a[3], exception);
+  CPPUNIT_ASSERT_THROW(a.insert("D", 4), exception);
+  CPPUNIT_ASSERT_THROW(SkipList<string>().unappend(), exception);
+  CPPUNIT_ASSERT(SkipList<string>({"Z", "A", "B", "D", "C"}) ==
+                 a.prepend("Z").insert("D", 3));
+  CPPUNIT_ASSERT("Z" == a.unprepend());
+  CPPUNIT_ASSERT("C" == a.unappend());
+  CPPUNIT_ASSERT(SkipList<string>({"A", "D"}) == a.remove("B", 1));
+  SkipList<string> b(a);
+  CPPUNIT_ASSERT(b == a);
+  SkipList<string> c(std::move(b));
+  CPPUNIT_ASSERT(c == a && b.isEmpty());
+  static_assert(std::is_nothrow_move_constructible<SkipList<string>>::value, "");
+  CPPUNIT_ASSERT(SkipList<string>({"E"}) == b.append("E") && "E" == b.getTail());
+  b.clear();
+  CPPUNIT_ASSERT(b.isEmpty() && !b.contains("E") && SkipList<string>() == b);
+  CPPUNIT_ASSERT_THROW(b.getHead(), exception);
+
+  // Elements can be moved in or built in place, so move-only types work.
+  SkipList<std::unique_ptr<int>> owners;
+  owners.append(std::unique_ptr<int>(new int(2))).prepend(std::unique_ptr<int>(new int(0)));
+  owners.insert(std::unique_ptr<int>(new int(1)), 1).emplaceBack(new int(4));
+  owners.emplace(3, new int(3)).emplaceFront();
+  CPPUNIT_ASSERT(6 == owners.size() && !owners[0] && 4 == *owners.getTail());
+  for (int i = 1; i < 6; ++i) CPPUNIT_ASSERT(i - 1 == *owners[i]);
+  CPPUNIT_ASSERT(3 == *owners.remove(4) && 5 == owners.size());
+
+  // Mirror random positional edits against a vector; tall nodes only show up
+  // once the list is large enough, so run long enough to build several levels.
+  SkipList<int> d;
+  std::vector<int> expected;
+  unsigned int seed = 3;
+  for (int i = 0; i < 20000; ++i) {
+    seed = seed * 1103515245 + 12345;
+    std::size_t index = (seed >> 8) % (expected.size() + 1);
+    if ((seed >> 4) % 4 || expected.empty()) {
+      d.insert(i, index);
+      expected.insert(expected.begin() + index, i);
+    } else {
+      if (index == expected.size()) --index;
+      CPPUNIT_ASSERT(expected[index] == d.remove(index));
+      expected.erase(expected.begin() + index);
+    }
+    if (i % 97 == 0) CPPUNIT_ASSERT(expected[index % expected.size()] ==
+                                    d[index % expected.size()]);
+  }
+  CPPUNIT_ASSERT(expected.size() == d.size());
+  std::size_t position = 0;
+  for (int data : d) CPPUNIT_ASSERT(expected[position++] == data);
+  for (std::size_t i = 0; i < expected.size(); ++i) CPPUNIT_ASSERT(expected[i] == d[i]);
+  while (!d.isEmpty()) {
+    CPPUNIT_ASSERT(expected.back() == d.unappend());
+    expected.pop_back();
+  }
+}
+
+// Random operations mirrored on a vector; value removal must take the first
+// occurrences, and the index must agree with a linear count afterwards.
+void TestLists::testIndexedLinkedList(void) {
+  IndexedLinkedList<string> a({"A", "B", "A"});
+  std::stringstream output;
+  output << a;
+  CPPUNIT_ASSERT("[A->B->A]" == output.str());
+  CPPUNIT_ASSERT(a.contains("A") && !a.contains("C"));
+  CPPUNIT_ASSERT(2 == a.count("A") && 1 == a.count("B") && 0 == a.count("C"));
+  CPPUNIT_ASSERT(IndexedLinkedList<string>({"B"}) == a.remove("A", 5));
+  CPPUNIT_ASSERT(!a.contains("A") && "B" == a.getHead() && "B" == a.getTail());
+  CPPUNIT_ASSERT("B" == a.unprepend());
+  CPPUNIT_ASSERT(a.isEmpty() && !a.contains("B"));
+  CPPUNIT_ASSERT_THROW(a.unappend(), exception);
+
+  IndexedLinkedList<int> b;
+  vector<int> expected;
+  unsigned int seed = 11;
+  for (int i = 0; i < 4000; ++i) {
+    seed = seed * 1103515245 + 12345;
+    int value = (seed >> 8) % 16;
+    std::size_t index = expected.empty() ? 0 : (seed >> 12) % expected.size();
+    switch ((seed >> 20) % 6) {
+      case 0:
+        b.append(value);
+        expected.push_back(value);
+        break;
+      case 1:
+        b.prepend(value);
+        expected.insert(expected.begin(), value);
+        break;
+      case 2:
+      case 3:
+        b.insert(value, index);
+        expected.insert(expected.begin() + index, value);
+        break;
+      case 4:
+        if (!expected.empty()) {
+          CPPUNIT_ASSERT(expected[index] == b.remove(index));
+          expected.erase(expected.begin() + index);
+        }
+        break;
+      case 5:
+        b.remove(value, 2);
+        for (int removed = 0; removed < 2; ++removed) {
+          auto it = find(expected.begin(), expected.end(), value);
+          if (it == expected.end()) break;
+          expected.erase(it);
+        }
+        break;
+    }
+  }
+  CPPUNIT_ASSERT(std::equal(expected.begin(), expected.end(), b.begin(), b.end()));
+  CPPUNIT_ASSERT(expected.size() == b.size());
+  for (int value = 0; value < 16; ++value)
+    CPPUNIT_ASSERT(std::size_t(count(expected.begin(), expected.end(), value)) == b.count(value));
+
+  IndexedLinkedList<int> c(b);
+  IndexedLinkedList<int> d(std::move(b));
+  CPPUNIT_ASSERT(c == d && b.isEmpty() && 0 == b.count(3));
+  d.remove(3, expected.size());
+  CPPUNIT_ASSERT(!d.contains(3) && c.contains(3));
+  c = d;
+  CPPUNIT_ASSERT(c == d && !c.contains(3));
+}
+
+// Non-copyable object that can sit in two intrusive lists at once.
+struct Job {
+  explicit Job(int id) : id(id) {}
+  Job(const Job&) = delete;
+  Job& operator=(const Job&) = delete;
+  friend ostream& operator<<(ostream& output, const Job& self) { return output << self.id; }
+
+  int id;
+  IntrusiveHook queueHook;
+  IntrusiveHook allHook;
+};
+
+void TestLists::testIntrusiveLinkedList(void) {
+  vector<unique_ptr<Job>> jobs;
+  for (int i = 0; i < 5; ++i) jobs.emplace_back(new Job(i));
+  IntrusiveLinkedList<Job, &Job::queueHook> queue;
+  IntrusiveLinkedList<Job, &Job::allHook> all;
+  CPPUNIT_ASSERT(queue.isEmpty() && queue.begin() == queue.end());
+  CPPUNIT_ASSERT_THROW(queue.getHead(), exception);
+  for (unique_ptr<Job>& job : jobs) all.append(*job);
+  queue.append(*jobs[2]).prepend(*jobs[0]).insert(*jobs[1], 1).insert(*jobs[4], 3);
+  std::stringstream output;
+  output << queue;
+  CPPUNIT_ASSERT("[0->1->2->4]" == output.str());
+  CPPUNIT_ASSERT(4 == queue.size() && 5 == all.size());
+  CPPUNIT_ASSERT(&queue[2] == jobs[2].get() && 4 == queue.getTail().id);
+  CPPUNIT_ASSERT_THROW(queue.append(*jobs[1]), exception);
+  CPPUNIT_ASSERT_THROW(queue[4], exception);
+
+  queue.remove(*jobs[1]);
+  CPPUNIT_ASSERT(!(IntrusiveLinkedList<Job, &Job::queueHook>::isLinked(*jobs[1])));
+  CPPUNIT_ASSERT(3 == queue.size() && 2 == queue[1].id);
+  CPPUNIT_ASSERT_THROW(queue.remove(*jobs[1]), exception);
+  CPPUNIT_ASSERT(jobs[0].get() == &queue.unprepend());
+  CPPUNIT_ASSERT(jobs[4].get() == &queue.unappend());
+  CPPUNIT_ASSERT(jobs[2].get() == &queue.remove(0) && queue.isEmpty());
+
+  int expected = 4;
+  for (auto it = all.end(); it != all.begin();) CPPUNIT_ASSERT(expected-- == (--it)->id);
+  all.remove(*jobs[3]).insert(*jobs[3], 0);
+  CPPUNIT_ASSERT(3 == all.getHead().id && 4 == all.getTail().id);
+
+  IntrusiveLinkedList<Job, &Job::allHook> moved(std::move(all));
+  CPPUNIT_ASSERT(all.isEmpty() && 5 == moved.size() && 3 == moved.getHead().id);
+  all = std::move(moved);
+  CPPUNIT_ASSERT(moved.isEmpty() && 5 == all.size() && 4 == all.getTail().id);
+  all.clear();
+  for (unique_ptr<Job>& job : jobs)
+    CPPUNIT_ASSERT(!(IntrusiveLinkedList<Job, &Job::allHook>::isLinked(*job)));
+}
+
+void TestLists::testCompactLinkedList(void) {
+  CompactLinkedList<int> a;
+  vector<int> expected;
+  CPPUNIT_ASSERT(a.isEmpty() && a.begin() == a.end());
+  CPPUNIT_ASSERT_THROW(a.getHead(), exception);
+  CPPUNIT_ASSERT_THROW(a.unappend(), exception);
+  unsigned int seed = 7;
+  for (int i = 0; i < 2000; ++i) {
+    seed = seed * 1103515245 + 12345;
+    std::size_t index = (seed >> 8) % (expected.size() + 1);
+    if (seed % 3 || expected.empty()) {
+      a.insert(i, index);
+      expected.insert(expected.begin() + index, i);
+    } else {
+      index %= expected.size();
+      CPPUNIT_ASSERT(expected[index] == a.remove(index));
+      expected.erase(expected.begin() + index);
+    }
+  }
+  CPPUNIT_ASSERT(expected.size() == a.size());
+  CPPUNIT_ASSERT(std::equal(a.begin(), a.end(), expected.begin(), expected.end()));
+  CPPUNIT_ASSERT(expected.front() == a.getHead() && expected.back() == a.getTail());
+  CPPUNIT_ASSERT(expected[expected.size() / 2] == a[expected.size() / 2]);
+  CPPUNIT_ASSERT_THROW(a[a.size()], exception);
+
+  std::size_t capacity = a.capacity();
+  a.compact();
+  CPPUNIT_ASSERT(capacity == a.capacity());
+  CPPUNIT_ASSERT(std::equal(a.begin(), a.end(), expected.begin(), expected.end()));
+  CPPUNIT_ASSERT(&a[0] + 10 == &a[10]);
+  a.append(-1).append(-2);
+  CPPUNIT_ASSERT(-2 == a.unappend() && -1 == a.getTail());
+  CPPUNIT_ASSERT(a.contains(-1) && !a.contains(-2));
+  a.remove(-1, 1).prepend(-3).remove(-3, 1);
+  CPPUNIT_ASSERT(std::equal(a.begin(), a.end(), expected.begin(), expected.end()));
+
+  CompactLinkedList<int> b(a);
+  CPPUNIT_ASSERT(a == b);
+  b[0] = -5;
+  CPPUNIT_ASSERT(a != b && -5 == b.getHead());
+  CompactLinkedList<int> c(std::move(b));
+  CPPUNIT_ASSERT(b.isEmpty() && -5 == c.getHead());
+  b = c;
+  c.clear();
+  CPPUNIT_ASSERT(c.isEmpty() && c.size() == 0 && b.size() == a.size());
+
+  CompactLinkedList<string> d({"A", "B"});
+  while (d.size() < 16) d.append(d[0]);
+  CPPUNIT_ASSERT("A" == d.getTail() && 16 == d.size());
+  d.remove("A", 15);
+  std::stringstream output;
+  output << d << CompactLinkedList<int>({1, 2, 3});
+  CPPUNIT_ASSERT("[B][1->2->3]" == output.str());
+
+  CompactLinkedList<unique_ptr<int>> e;
+  for (int i = 0; i < 10; ++i) e.prepend(unique_ptr<int>(new int(i)));
+  CPPUNIT_ASSERT(9 == *e.unprepend() && 0 == *e.unappend());
+  e.compact();
+  CPPUNIT_ASSERT(8 == *e.getHead() && 1 == *e.getTail() && 8 == e.size());
+}
+
+// Checks the kernels against the scalar loop at every length and match
+// position up to a few registers.
+template <typename T>
+static bool blockSearchAgrees(void) {
+  for (std::size_t length = 0; length < 80; ++length) {
+    vector<T> values(length, T(1));
+    vector<T> other(values);
+    if (BlockSearch<T>::find(values.data(), length, T(2)) != length) return false;
+    if (!BlockSearch<T>::equal(values.data(), other.data(), length)) return false;
+    for (std::size_t at = 0; at < length; ++at) {
+      values[at] = T(2);
+      if (at % 3 == 0 && at + 1 < length) values[at + 1] = T(2);
+      std::size_t count = std::count(values.begin(), values.end(), T(2));
+      if (BlockSearch<T>::find(values.data(), length, T(2)) != at) return false;
+      if (BlockSearch<T>::count(values.data(), length, T(2)) != count) return false;
+      if (BlockSearch<T>::equal(values.data(), other.data(), length)) return false;
+      std::fill(values.begin(), values.end(), T(1));
+    }
+  }
+  return true;
+}
+
+void TestLists::testBlockSearch(void) {
+  // make testlists-avx2 runs these on the 256-bit kernels.
+#if defined(__AVX2__)
+  static_assert(32 == sizeof(detail::BlockRegister), "AVX2 builds use 256-bit registers");
+#elif defined(__SSE2__)
+  static_assert(16 == sizeof(detail::BlockRegister), "SSE2 builds use 128-bit registers");
+#endif
+  CPPUNIT_ASSERT(blockSearchAgrees<signed char>());
+  CPPUNIT_ASSERT(blockSearchAgrees<uint16_t>());
+  CPPUNIT_ASSERT(blockSearchAgrees<int>());
+  CPPUNIT_ASSERT(blockSearchAgrees<uint64_t>());
+  CPPUNIT_ASSERT(blockSearchAgrees<float>());
+  CPPUNIT_ASSERT(blockSearchAgrees<double>());
+  CPPUNIT_ASSERT(blockSearchAgrees<long double>());
+
+  // 64-bit lanes must match on both halves.
+  vector<uint64_t> wide(8, 5);
+  wide[6] = (uint64_t(7) << 32) | 5;
+  CPPUNIT_ASSERT(8 == BlockSearch<uint64_t>::find(wide.data(), 8, 7));
+  CPPUNIT_ASSERT(6 == BlockSearch<uint64_t>::find(wide.data(), 8, wide[6]));
+  vector<float> floats(16, 0.0f);
+  floats[9] = std::numeric_limits<float>::quiet_NaN();
+  CPPUNIT_ASSERT(15 == BlockSearch<float>::count(floats.data(), 16, -0.0f));
+  CPPUNIT_ASSERT(16 == BlockSearch<float>::find(floats.data(), 16, floats[9]));
+  CPPUNIT_ASSERT(!BlockSearch<float>::equal(floats.data(), floats.data(), 16));
+
+  UnrolledLinkedList<int, 16> a, b;
+  for (int i = 0; i < 100; ++i) a.append(i % 7);
+  for (int i = 99; i >= 0; --i) b.prepend(i % 7);
+  a.remove(std::size_t(50));
+  b.remove(std::size_t(50));
+  CPPUNIT_ASSERT(a == b && 14 == a.count(3) && a.contains(6) && !a.contains(7));
+  b[98] = 7;
+  CPPUNIT_ASSERT(a != b && b.contains(7) && 1 == b.count(7));
+  a.remove(0, 10);
+  CPPUNIT_ASSERT(5 == a.count(0) && 89 == a.size() && 1 == a[0]);
+  a.remove(0, 100).remove(5, 100);
+  CPPUNIT_ASSERT(!a.contains(0) && !a.contains(5) && 1 == a.getHead());
+
+  CompactLinkedList<double> c({1.5, 2.5, 3.5}), d({1.5, 2.5, 3.5});
+  CPPUNIT_ASSERT(c == d && c.contains(3.5) && !c.contains(4.5));
+  d.prepend(0.5).unprepend();
+  CPPUNIT_ASSERT(c == d && d.contains(3.5));
+}
+
+void TestLists::testListFiles(void) {
+  const string path = "testlists.list";
+  LinkedList<int> a;
+  for (int i = 0; i < 100000; ++i) a.append(i * 3);
+  a.save(path);
+  LinkedList<int> b({7});
+  CPPUNIT_ASSERT(a == b.load(path));
+  MappedList<int> mapped(path);
+  CPPUNIT_ASSERT(100000 == mapped.size() && 3 == mapped[1] && 299997 == mapped.getTail());
+  CPPUNIT_ASSERT(mapped.contains(2997) && !mapped.contains(2998));
+  CPPUNIT_ASSERT(std::equal(mapped.begin(), mapped.end(), a.begin()));
+  CPPUNIT_ASSERT_THROW(mapped[100000], exception);
+  MappedList<int> moved(std::move(mapped));
+  CPPUNIT_ASSERT(mapped.isEmpty() && 100000 == moved.size());
+
+  CompactLinkedList<int> c({5, 6});
+  CPPUNIT_ASSERT(100000 == c.load(path).size() && 3 == c[1] && c == CompactLinkedList<int>(c));
+  c.prepend(-1).insert(-2, 50).save(path);
+  CPPUNIT_ASSERT(100002 == b.load(path).size() && -1 == b.getHead() && -2 == b[50]);
+  CPPUNIT_ASSERT(c == CompactLinkedList<int>().load(path));
+
+  LinkedList<string> d({"", "A", string(100000, 'B')});
+  d.save(path);
+  CPPUNIT_ASSERT(d == LinkedList<string>().load(path));
+  CompactLinkedList<string> e;
+  CPPUNIT_ASSERT(string(100000, 'B') == e.load(path).getTail() && "" == e.getHead());
+
+  // Mismatched types and damaged or missing files are refused, and the
+  // list being loaded into is left as it was.
+  CPPUNIT_ASSERT_THROW(b.load(path), exception);
+  CPPUNIT_ASSERT_THROW(MappedList<int> view(path), exception);
+  a.save(path);
+  CPPUNIT_ASSERT_THROW(LinkedList<float>().load(path), exception);
+  CPPUNIT_ASSERT_THROW(LinkedList<unsigned int>().load(path), exception);
+  LinkedList<bool>({true, false}).save(path);
+  CPPUNIT_ASSERT(LinkedList<bool>({true, false}) == LinkedList<bool>().load(path));
+  CPPUNIT_ASSERT_THROW(LinkedList<unsigned char>().load(path), exception);
+  CPPUNIT_ASSERT_THROW(LinkedList<signed char>().load(path), exception);
+  a.save(path);
+  CPPUNIT_ASSERT(0 == truncate(path.c_str(), 1000));
+  CPPUNIT_ASSERT_THROW(b.load(path), exception);
+  CPPUNIT_ASSERT_THROW(MappedList<int> view(path), exception);
+  CPPUNIT_ASSERT(100002 == b.size() && -1 == b.getHead());
+  d.save(path);
+  FILE* damaged = fopen(path.c_str(), "r+b");
+  const uint64_t recordSize = uint64_t(1) << 60;
+  CPPUNIT_ASSERT(damaged && 0 == fseek(damaged, sizeof(ListFileHeader), SEEK_SET));
+  CPPUNIT_ASSERT(1 == fwrite(&recordSize, sizeof(recordSize), 1, damaged) && 0 == fclose(damaged));
+  CPPUNIT_ASSERT_THROW(LinkedList<string>(d).load(path), std::runtime_error);
+  CPPUNIT_ASSERT(0 == truncate(path.c_str(), sizeof(ListFileHeader) + 4));
+  CPPUNIT_ASSERT_THROW(LinkedList<string>(d).load(path), std::runtime_error);
+
+  // An element count the rest of the file cannot hold is refused up front.
+  auto setLength = [&path](const uint64_t length) {
+    FILE* file = fopen(path.c_str(), "r+b");
+    CPPUNIT_ASSERT(file && 0 == fseek(file, offsetof(ListFileHeader, length), SEEK_SET));
+    CPPUNIT_ASSERT(1 == fwrite(&length, sizeof(length), 1, file) && 0 == fclose(file));
+  };
+  d.save(path);
+  setLength(uint64_t(1) << 40);
+  CPPUNIT_ASSERT_THROW(ListFileReader<string> reader(path), std::runtime_error);
+  a.save(path);
+  setLength(100001);
+  CPPUNIT_ASSERT_THROW(ListFileReader<int> reader(path), std::runtime_error);
+  setLength(99999);
+  CPPUNIT_ASSERT(99999 == ListFileReader<int>(path).size());
+  CompactLinkedList<long> f({1, 2, 3});
+  f.save(path);
+  setLength(4294967294u);
+  CPPUNIT_ASSERT_THROW(f.load(path), std::runtime_error);
+  setLength(4);
+  CPPUNIT_ASSERT_THROW(f.load(path), std::runtime_error);
+  setLength(2);
+  CPPUNIT_ASSERT(CompactLinkedList<long>({1, 2}) == f.load(path));
+  std::remove(path.c_str());
+  CPPUNIT_ASSERT_THROW(b.load(path), exception);
+  CPPUNIT_ASSERT_THROW(MappedList<int> view(path), exception);
+  CPPUNIT_ASSERT_THROW(a.save("missing-directory/" + path), exception);
+
+  LinkedList<double>().save(path);
+  CPPUNIT_ASSERT(MappedList<double>(path).isEmpty());
+  CPPUNIT_ASSERT(LinkedList<double>({1.0}).load(path).isEmpty());
+
+  // Refused files are closed: the next descriptor opened is the same one.
+  FILE* bad = fopen(path.c_str(), "wb");
+  const char garbage[64] = "not a list file";
+  CPPUNIT_ASSERT(bad && 1 == fwrite(garbage, sizeof(garbage), 1, bad) && 0 == fclose(bad));
+  FILE* probe = fopen(path.c_str(), "rb");
+  const int descriptor = fileno(probe);
+  fclose(probe);
+  for (int i = 0; i < 50; ++i) CPPUNIT_ASSERT_THROW(LinkedList<int>().load(path), exception);
+  CPPUNIT_ASSERT(0 == truncate(path.c_str(), 16));
+  for (int i = 0; i < 50; ++i) CPPUNIT_ASSERT_THROW(LinkedList<int>().load(path), exception);
+  probe = fopen(path.c_str(), "rb");
+  CPPUNIT_ASSERT(descriptor == fileno(probe));
+  fclose(probe);
+  std::remove(path.c_str());
+}
+
+void TestLists::testPersistentList(void) {
+  const PersistentList<int> a({1, 2, 3});
+  CPPUNIT_ASSERT(3 == a.size() && 1 == a.getHead() && 3 == a.getTail());
+  const PersistentList<int> b = a.prepend(0);
+  CPPUNIT_ASSERT(4 == b.size() && 0 == b.getHead() && 3 == b.getTail() && 3 == a.size());
+  CPPUNIT_ASSERT(&b[1] == &a[0] && b.unprepend() == a);
+  CPPUNIT_ASSERT(&b.drop(2)[0] == &a[1] && 2 == b.drop(2).size());
+  CPPUNIT_ASSERT(b.drop(4).isEmpty() && b.unprepend().unprepend().unprepend().unprepend().isEmpty());
+  CPPUNIT_ASSERT_THROW(PersistentList<int>().unprepend(), exception);
+  CPPUNIT_ASSERT_THROW(b.drop(5), exception);
+
+  // Changes past the front copy the nodes before the position only.
+  const PersistentList<int> c = b.insert(9, 2);
+  CPPUNIT_ASSERT(PersistentList<int>({0, 1, 9, 2, 3}) == c && &c[3] == &a[1] && &c[1] != &a[0]);
+  const PersistentList<int> d = b.remove(3);
+  CPPUNIT_ASSERT(PersistentList<int>({0, 1, 2}) == d && 2 == d.getTail() && 4 == b.size());
+  const PersistentList<int> e = d.append(4).append(5);
+  CPPUNIT_ASSERT(5 == e.getTail() && 2 == d.getTail() && 5 == e.size() && e.contains(4));
+  CPPUNIT_ASSERT(PersistentList<int>(7).remove(0).isEmpty() && 1 == a.remove(1).remove(1)[0]);
+  CPPUNIT_ASSERT(1 == a.remove(1).remove(1).getTail());
+  CPPUNIT_ASSERT_THROW(a.insert(1, 4), exception);
+  CPPUNIT_ASSERT_THROW(a.remove(3), exception);
+  CPPUNIT_ASSERT_THROW(a[3], exception);
+  CPPUNIT_ASSERT(a != b && a != a.remove(2).append(4) && a == a.remove(2).append(3));
+
+  PersistentList<string> f;
+  f = f.prepend("B").prepend("A");
+  PersistentList<string> snapshot = f;
+  f = f.append("C").unprepend();
+  std::stringstream output;
+  output << snapshot << f << PersistentList<string>();
+  CPPUNIT_ASSERT("[A->B][B->C][]" == output.str());
+
+  // Readers keep their snapshots while a writer builds new versions, and a
+  // long chain is released without recursion.
+  PersistentList<int> shared;
+  for (int i = 0; i < 100000; ++i) shared = shared.prepend(i);
+  vector<std::thread> readers;
+  std::atomic<int> mismatches(0);
+  for (int r = 0; r < 4; ++r)
+    readers.emplace_back([shared, &mismatches] {
+      PersistentList<int> mine = shared;
+      for (int round = 0; round < 20; ++round) {
+        mine = mine.prepend(round).unprepend();
+        if (std::accumulate(mine.begin(), mine.end(), int64_t(0)) != int64_t(4999950000))
+          ++mismatches;
+      }
+    });
+  for (int i = 0; i < 1000; ++i) shared = shared.unprepend().prepend(-i);
+  for (std::thread& reader : readers) reader.join();
+  CPPUNIT_ASSERT(0 == mismatches && 100000 == shared.size() && -999 == shared.getHead());
+}
+
+void TestLists::testStaticLinkedList(void) {
+  static_assert(27 == staticListSum(), "StaticLinkedList works in constant expressions");
+  static_assert(sizeof(StaticLinkedList<char, 200>::Index) == 1, "small lists use byte links");
+  static_assert(sizeof(StaticLinkedList<char, 300>::Index) == 2, "larger lists widen the links");
+
+  StaticLinkedList<int, 4> a({1, 2, 3});
+  CPPUNIT_ASSERT(3 == a.size() && 1 == a.getHead() && 3 == a.getTail() && 4 == a.capacity());
+  a.append(4);
+  CPPUNIT_ASSERT(a.isFull() && a.contains(4) && !a.contains(5));
+  CPPUNIT_ASSERT_THROW(a.append(5), ListIndexOutOfBounds);
+  CPPUNIT_ASSERT_THROW(a.prepend(0), ListIndexOutOfBounds);
+  CPPUNIT_ASSERT(!a.tryAppend(5) && !a.tryPrepend(0) && !a.tryInsert(0, 1) && 4 == a.size());
+
+  // Removed slots are reused, wherever they are in the arrays.
+  CPPUNIT_ASSERT(2 == a.remove(1) && 1 == a.unprepend() && 4 == a.unappend());
+  CPPUNIT_ASSERT(a.tryPrepend(7) && a.tryInsert(8, 1) && a.tryAppend(9) && a.isFull());
+  CPPUNIT_ASSERT(!a.tryInsert(1, 9));
+  CPPUNIT_ASSERT((StaticLinkedList<int, 4>({7, 8, 3, 9}) == a));
+  a.remove(8, 1).remove(3, 1);
+  CPPUNIT_ASSERT((StaticLinkedList<int, 4>({7, 9}) == a) && 9 == a.getTail());
+  CPPUNIT_ASSERT_THROW(a[2], ListIndexOutOfBounds);
+  CPPUNIT_ASSERT_THROW(a.insert(1, 3), ListIndexOutOfBounds);
+  a.clear();
+  CPPUNIT_ASSERT(a.isEmpty() && a.begin() == a.end());
+  CPPUNIT_ASSERT_THROW(a.unappend(), ListIndexOutOfBounds);
+  CPPUNIT_ASSERT_THROW(a.getHead(), ListIndexOutOfBounds);
+
+  StaticLinkedList<string, 3> b({"B", "C"});
+  b.prepend(string("A"));
+  StaticLinkedList<string, 3> c = b;
+  c.remove(1);
+  c.append("D");
+  *c.begin() = "Z";
+  std::stringstream output;
+  output << b << c << StaticLinkedList<string, 3>();
+  CPPUNIT_ASSERT("[A->B->C][Z->C->D][]" == output.str() && b != c);
+  StaticLinkedList<string, 3>::const_iterator first = c.begin();
+  CPPUNIT_ASSERT(1 == first->size() && c.cend() == std::next(first, 3));
+}
+
+
+void TestLists::testListViews(void) {
+  static_assert(std::forward_iterator<LinkedList<int>::const_iterator>, "");
+  static_assert(std::ranges::forward_range<UnrolledLinkedList<int, 4>>, "");
+  static_assert(std::ranges::forward_range<SkipList<int>>, "");
+  static_assert(std::ranges::bidirectional_range<DoublyLinkedList<int>>, "");
+  static_assert(std::ranges::forward_range<PersistentList<int>>, "");
+  static_assert(std::ranges::forward_range<StaticLinkedList<int, 4>>, "");
+  static_assert(std::ranges::view<ListGenerator<int&>>, "");
+
+  // Standard adaptors compose over any list and only walk what they need.
+  LinkedList<int> a({1, 2, 3, 4, 5, 6, 7, 8});
+  auto pipeline = a | std::views::filter([](const int data) { return data % 2 == 0; }) |
+                  std::views::transform([](const int data) { return data * 10; }) |
+                  std::views::drop(1) | std::views::take(2) | std::views::common;
+  CPPUNIT_ASSERT((vector<int>{40, 60} == vector<int>(pipeline.begin(), pipeline.end())));
+  a.append(10);
+  int sum = 0;
+  for (const int data : a | std::views::filter([](const int data) { return data > 7; }))
+    sum += data;
+  CPPUNIT_ASSERT(18 == sum);
+  DoublyLinkedList<int> b({1, 2, 3});
+  auto reversed = b | std::views::reverse | std::views::take(2) | std::views::common;
+  CPPUNIT_ASSERT((vector<int>{3, 2} == vector<int>(reversed.begin(), reversed.end())));
+  SkipList<int> c({5, 1, 3});
+  CPPUNIT_ASSERT(1 == std::ranges::distance(c | std::views::drop(2)));
+
+  // Generators yield by reference from the list's own chain.
+  for (int& data : generate(a)) data = -data;
+  CPPUNIT_ASSERT(-1 == a.getHead() && -10 == a.getTail());
+  for (int& data : generate(a)) data = -data;
+  vector<int> squares;
+  for (const int data : evenSquares(a) | std::views::take(3)) squares.push_back(data);
+  CPPUNIT_ASSERT((vector<int>{4, 16, 36} == squares));
+  ListGenerator<int> failing = failAfter(2);
+  ListGenerator<int>::iterator position = failing.begin();
+  CPPUNIT_ASSERT(0 == *position && 1 == *++position);
+  CPPUNIT_ASSERT_THROW(++position, std::runtime_error);
+  CPPUNIT_ASSERT(position == failing.end());
+
+  // Zip pairs elements up to the shorter list and writes through to both.
+  const PersistentList<int> d({100, 200, 300});
+  for (auto [left, right] : zip(a, d)) left += right;
+  CPPUNIT_ASSERT((LinkedList<int>({101, 202, 303, 4, 5, 6, 7, 8, 10}) == a));
+  auto difference = [](const auto pair) { return pair.second - pair.first; };
+  auto tail = zip(d, a) | std::views::transform(difference) | std::views::common;
+  CPPUNIT_ASSERT((vector<int>{1, 2, 3} == vector<int>(tail.begin(), tail.end())));
+  LinkedList<int> empty;
+  CPPUNIT_ASSERT(zip(a, empty).empty() && 3 == std::ranges::distance(zip(b, a)));
+}
+
 //-----------------------------------------------------------------------------
 
 CPPUNIT_TEST_SUITE_REGISTRATION(TestLists);
@@ -0,0 +1,169 @@
+#ifndef THREADPOOL_HPP
+#define THREADPOOL_HPP
+
+#include <stddef.h>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Work-stealing thread pool behind the lists' parallel traversals. Each worker
+// has its own task queue: it takes its newest task first and, once its queue
+// is empty, steals the oldest task of another worker. run() spreads a batch
+// of tasks over the queues and has the calling thread work through them too,
+// so a pool with no workers still makes progress and a task may itself call
+// run() on the same pool.
+class ThreadPool {
+ public:
+  explicit ThreadPool(const std::size_t);
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool& operator=(const ThreadPool&) = delete;
+  ~ThreadPool();
+
+  // Pool with a worker per hardware thread besides the caller's.
+  static ThreadPool& shared();
+
+  const std::size_t size() const;
+
+  // Calls body(i) for every i in [0, count) and returns when all calls have
+  // finished. The first exception thrown by a call is rethrown here.
+  template <typename Body>
+  void run(const std::size_t, Body);
+
+ private:
+  using Task = std::function<void()>;
+
+  struct Queue {
+    std::mutex lock;
+    std::deque<Task> tasks;
+  };
+
+  // Tasks of one run() call still to finish.
+  struct Batch {
+    std::mutex lock;
+    std::condition_variable finished;
+    std::size_t pending;
+    std::exception_ptr failure;
+  };
+
+  void work(const std::size_t);
+  void submit(const std::size_t, Task);
+  bool take(const std::size_t, Task&);
+
+  std::vector<std::unique_ptr<Queue>> queues;
+  std::vector<std::thread> workers;
+  std::atomic<std::size_t> queued;
+  std::mutex sleepLock;
+  std::condition_variable wake;
+  bool stopping;
+};
+
+inline ThreadPool::ThreadPool(const std::size_t workers) : queued(0), stopping(false) {
+  // The last queue is shared by the threads calling run().
+  for (std::size_t i = 0; i <= workers; ++i) this->queues.emplace_back(new Queue());
+  for (std::size_t i = 0; i < workers; ++i)
+    this->workers.emplace_back(&ThreadPool::work, this, i);
+}
+
+inline ThreadPool::~ThreadPool() {
+  {
+    std::lock_guard<std::mutex> lock(this->sleepLock);
+    this->stopping = true;
+  }
+  this->wake.notify_all();
+  for (std::thread& worker : this->workers) worker.join();
+}
+
+inline ThreadPool& ThreadPool::shared() {
+  static ThreadPool pool(std::thread::hardware_concurrency() > 1
+                             ? std::thread::hardware_concurrency() - 1
+                             : 0);
+  return pool;
+}
+
+inline const std::size_t ThreadPool::size() const {
+  return this->workers.size();
+}
+
+template <typename Body>
+void ThreadPool::run(const std::size_t count, Body body) {
+  if (count == 0) return;
+  Batch batch;
+  batch.pending = count;
+  for (std::size_t i = 0; i < count; ++i)
+    this->submit(i % this->queues.size(), [&batch, &body, i] {
+      try {
+        body(i);
+      } catch (...) {
+        std::lock_guard<std::mutex> lock(batch.lock);
+        if (!batch.failure) batch.failure = std::current_exception();
+      }
+      std::lock_guard<std::mutex> lock(batch.lock);
+      if (--batch.pending == 0) batch.finished.notify_all();
+    });
+  Task task;
+  while (this->take(this->workers.size(), task)) {
+    task();
+    std::lock_guard<std::mutex> lock(batch.lock);
+    if (batch.pending == 0) break;
+  }
+  std::unique_lock<std::mutex> lock(batch.lock);
+  batch.finished.wait(lock, [&batch] { return batch.pending == 0; });
+  if (batch.failure) std::rethrow_exception(batch.failure);
+}
+
+inline void ThreadPool::work(const std::size_t index) {
+  Task task;
+  while (true) {
+    if (this->take(index, task)) {
+      task();
+      continue;
+    }
+    std::unique_lock<std::mutex> lock(this->sleepLock);
+    this->wake.wait(lock, [this] { return this->stopping || this->queued > 0; });
+    if (this->stopping && this->queued == 0) return;
+  }
+}
+
+// Counts the task before queueing it, so the count never drops below the
+// number of queued tasks. Taking sleepLock orders the count with a worker
+// about to sleep.
+inline void ThreadPool::submit(const std::size_t index, Task task) {
+  {
+    std::lock_guard<std::mutex> lock(this->sleepLock);
+    ++this->queued;
+  }
+  {
+    std::lock_guard<std::mutex> lock(this->queues[index]->lock);
+    this->queues[index]->tasks.push_back(std::move(task));
+  }
+  this->wake.notify_one();
+}
+
+// Pops the newest task of queue `index`, or else steals the oldest task of
+// another queue.
+inline bool ThreadPool::take(const std::size_t index, Task& task) {
+  if (this->queued == 0) return false;
+  for (std::size_t offset = 0; offset < this->queues.size(); ++offset) {
+    Queue& queue = *this->queues[(index + offset) % this->queues.size()];
+    std::lock_guard<std::mutex> lock(queue.lock);
+    if (queue.tasks.empty()) continue;
+    if (offset == 0) {
+      task = std::move(queue.tasks.back());
+      queue.tasks.pop_back();
+    } else {
+      task = std::move(queue.tasks.front());
+      queue.tasks.pop_front();
+    }
+    --this->queued;
+    return true;
+  }
+  return false;
+}
+
+#endif
@@ -0,0 +1,458 @@
+#ifndef UNROLLEDLINKEDLIST_HPP
+#define UNROLLEDLINKEDLIST_HPP
+
+#include <stddef.h>
+#include <algorithm>
+#include <initializer_list>
+#include <new>
+#include <ostream>
+#include <utility>
+#include "BlockSearch.hpp"
+#include "ListIndexOutOfBounds.hpp"
+#include "UnrolledLinkedListIterator.hpp"
+#include "UnrolledNode.hpp"
+
+// Singly linked list storing up to N elements per node. Nodes are split when
+// an insert overflows them. A node that removals leave with fewer than N / 2
+// elements is merged with its successor when the two fit in one node, and
+// otherwise takes elements from it, so every node but the last holds at least
+// N / 2 elements. Searches and comparisons scan a node's elements with BlockSearch,
+// which vectorizes them for arithmetic types.
+template <typename T, std::size_t N = 16>
+class UnrolledLinkedList {
+ public:
+  // Constructors
+  UnrolledLinkedList();
+  UnrolledLinkedList(const T&);
+  UnrolledLinkedList(const std::initializer_list<T>);
+  UnrolledLinkedList(const UnrolledLinkedList&);
+  UnrolledLinkedList& operator=(const UnrolledLinkedList&);
+  ~UnrolledLinkedList();
+
+  // Getters
+  const T& getHead() const;
+  const T& getTail() const;
+  const bool isEmpty() const;
+  const bool contains(const T&) const;
+  const std::size_t count(const T&) const;
+  const std::size_t size() const;
+  const std::size_t nodeCount() const;
+
+  // Mutators
+  UnrolledLinkedList<T, N>& append(const T&);
+  UnrolledLinkedList<T, N>& prepend(const T&);
+  UnrolledLinkedList<T, N>& insert(const T&, const std::size_t);
+  T unappend();
+  T unprepend();
+  T remove(const std::size_t);
+  UnrolledLinkedList<T, N>& remove(const T&, const std::size_t);
+  void clear();
+
+  // Iterators
+  UnrolledLinkedListIterator<T, N> begin() const;
+  UnrolledLinkedListIterator<T, N> end() const;
+
+  // Operators
+  const bool operator==(const UnrolledLinkedList&) const;
+  const bool operator!=(const UnrolledLinkedList&) const;
+  const T& operator[](const std::size_t) const;
+  T& operator[](const std::size_t);
+
+  // Friend Operator
+  friend std::ostream& operator<<(std::ostream& output,
+                                  const UnrolledLinkedList& self) {
+    output << "[";
+    bool first = true;
+    for (UnrolledNode<T, N>* current = self.head; current; current = current->next)
+      for (std::size_t i = 0; i < current->count; ++i) {
+        if (!first) output << "->";
+        output << (*current)[i];
+        first = false;
+      }
+    output << "]";
+    return output;
+  }
+
+ private:
+  UnrolledNode<T, N>* locate(std::size_t&, UnrolledNode<T, N>** = nullptr) const;
+  void insertAt(UnrolledNode<T, N>*, std::size_t, const T&);
+  T eraseAt(UnrolledNode<T, N>*, UnrolledNode<T, N>*, const std::size_t);
+  void split(UnrolledNode<T, N>*);
+  void mergeNext(UnrolledNode<T, N>*);
+  void rebalance(UnrolledNode<T, N>*);
+  void unlink(UnrolledNode<T, N>*, UnrolledNode<T, N>*);
+  void destroyNode(UnrolledNode<T, N>*);
+
+  UnrolledNode<T, N>* head;
+  UnrolledNode<T, N>* tail;
+  std::size_t length;
+};
+
+template <typename T, std::size_t N>
+UnrolledLinkedList<T, N>::UnrolledLinkedList()
+    : head(nullptr), tail(nullptr), length(0) {}
+
+template <typename T, std::size_t N>
+UnrolledLinkedList<T, N>::UnrolledLinkedList(const T& data)
+    : head(nullptr), tail(nullptr), length(0) {
+  this->append(data);
+}
+
+template <typename T, std::size_t N>
+UnrolledLinkedList<T, N>::UnrolledLinkedList(const std::initializer_list<T> args)
+    : head(nullptr), tail(nullptr), length(0) {
+  for (const T& data : args) this->append(data);
+}
+
+template <typename T, std::size_t N>
+UnrolledLinkedList<T, N>::UnrolledLinkedList(const UnrolledLinkedList& other)
+    : head(nullptr), tail(nullptr), length(0) {
+  for (UnrolledNode<T, N>* current = other.head; current; current = current->next)
+    for (std::size_t i = 0; i < current->count; ++i) this->append((*current)[i]);
+}
+
+template <typename T, std::size_t N>
+UnrolledLinkedList<T, N>& UnrolledLinkedList<T, N>::operator=(
+    const UnrolledLinkedList& other) {
+  if (this != &other) {
+    UnrolledLinkedList<T, N> copy(other);
+    std::swap(this->head, copy.head);
+    std::swap(this->tail, copy.tail);
+    std::swap(this->length, copy.length);
+  }
+  return *this;
+}
+
+template <typename T, std::size_t N>
+UnrolledLinkedList<T, N>::~UnrolledLinkedList() {
+  this->clear();
+}
+
+template <typename T, std::size_t N>
+const T& UnrolledLinkedList<T, N>::getHead() const {
+  if (this->isEmpty()) throw ListIndexOutOfBounds();
+  return (*this->head)[0];
+}
+
+template <typename T, std::size_t N>
+const T& UnrolledLinkedList<T, N>::getTail() const {
+  if (this->isEmpty()) throw ListIndexOutOfBounds();
+  return (*this->tail)[this->tail->count - 1];
+}
+
+template <typename T, std::size_t N>
+const bool UnrolledLinkedList<T, N>::isEmpty() const {
+  return this->head == nullptr;
+}
+
+template <typename T, std::size_t N>
+const bool UnrolledLinkedList<T, N>::contains(const T& data) const {
+  for (UnrolledNode<T, N>* current = this->head; current; current = current->next)
+    if (BlockSearch<T>::find(current->elements(), current->count, data) < current->count)
+      return true;
+  return false;
+}
+
+template <typename T, std::size_t N>
+const std::size_t UnrolledLinkedList<T, N>::count(const T& data) const {
+  std::size_t found = 0;
+  for (UnrolledNode<T, N>* current = this->head; current; current = current->next)
+    found += BlockSearch<T>::count(current->elements(), current->count, data);
+  return found;
+}
+
+template <typename T, std::size_t N>
+const std::size_t UnrolledLinkedList<T, N>::size() const {
+  return this->length;
+}
+
+template <typename T, std::size_t N>
+const std::size_t UnrolledLinkedList<T, N>::nodeCount() const {
+  std::size_t nodes = 0;
+  for (UnrolledNode<T, N>* current = this->head; current; current = current->next) ++nodes;
+  return nodes;
+}
+
+template <typename T, std::size_t N>
+UnrolledLinkedList<T, N>& UnrolledLinkedList<T, N>::append(const T& data) {
+  if (this->isEmpty()) {
+    this->head = new UnrolledNode<T, N>();
+    this->tail = this->head;
+  } else if (this->tail->count == N) {
+    this->tail->next = new UnrolledNode<T, N>();
+    this->tail = this->tail->next;
+  }
+  this->insertAt(this->tail, this->tail->count, data);
+  return *this;
+}
+
+template <typename T, std::size_t N>
+UnrolledLinkedList<T, N>& UnrolledLinkedList<T, N>::prepend(const T& data) {
+  // A full head is split rather than given a nearly empty node in front.
+  if (this->isEmpty()) {
+    this->head = new UnrolledNode<T, N>();
+    this->tail = this->head;
+  }
+  this->insertAt(this->head, 0, data);
+  return *this;
+}
+
+template <typename T, std::size_t N>
+UnrolledLinkedList<T, N>& UnrolledLinkedList<T, N>::insert(const T& data,
+                                                           const std::size_t index) {
+  if (index > this->length) throw ListIndexOutOfBounds(index, this->length);
+  if (index == 0)
+    return this->prepend(data);
+  else if (index == this->length)
+    return this->append(data);
+  std::size_t offset = index;
+  UnrolledNode<T, N>* node = this->locate(offset);
+  this->insertAt(node, offset, data);
+  return *this;
+}
+
+template <typename T, std::size_t N>
+T UnrolledLinkedList<T, N>::unappend() {
+  if (this->isEmpty()) throw ListIndexOutOfBounds(0, 0);
+  return this->remove(this->length - 1);
+}
+
+template <typename T, std::size_t N>
+T UnrolledLinkedList<T, N>::unprepend() {
+  if (this->isEmpty()) throw ListIndexOutOfBounds(0, 0);
+  return this->eraseAt(nullptr, this->head, 0);
+}
+
+template <typename T, std::size_t N>
+T UnrolledLinkedList<T, N>::remove(const std::size_t index) {
+  if (index >= this->length) throw ListIndexOutOfBounds(index, this->length);
+  std::size_t offset = index;
+  UnrolledNode<T, N>* prior = nullptr;
+  UnrolledNode<T, N>* node = this->locate(offset, &prior);
+  return this->eraseAt(prior, node, offset);
+}
+
+template <typename T, std::size_t N>
+UnrolledLinkedList<T, N>& UnrolledLinkedList<T, N>::remove(const T& data,
+                                                           const std::size_t num) {
+  std::size_t numRemoved = 0;
+  UnrolledNode<T, N>* prior = nullptr;
+  UnrolledNode<T, N>* current = this->head;
+  while (current && numRemoved < num) {
+    std::size_t kept = BlockSearch<T>::find(current->elements(), current->count, data);
+    if (kept < current->count) {
+      for (std::size_t i = kept; i < current->count; ++i)
+        if (numRemoved < num && (*current)[i] == data)
+          ++numRemoved;
+        else if (kept++ != i)
+          (*current)[kept - 1] = std::move((*current)[i]);
+      for (std::size_t i = kept; i < current->count; ++i) (*current)[i].~T();
+      this->length -= current->count - kept;
+      current->count = kept;
+    }
+    UnrolledNode<T, N>* next = current->next;
+    if (kept == 0) {
+      this->unlink(prior, current);
+    } else {
+      // Nodes are rebalanced once their successor has lost its elements too.
+      if (prior) this->rebalance(prior);
+      if (!prior || prior->next == current) prior = current;
+    }
+    current = next;
+  }
+  if (prior) this->rebalance(prior);
+  return *this;
+}
+
+template <typename T, std::size_t N>
+void UnrolledLinkedList<T, N>::clear() {
+  while (this->head) {
+    UnrolledNode<T, N>* next = this->head->next;
+    this->destroyNode(this->head);
+    this->head = next;
+  }
+  this->tail = nullptr;
+  this->length = 0;
+}
+
+template <typename T, std::size_t N>
+UnrolledLinkedListIterator<T, N> UnrolledLinkedList<T, N>::begin() const {
+  return UnrolledLinkedListIterator<T, N>(this->head);
+}
+
+template <typename T, std::size_t N>
+UnrolledLinkedListIterator<T, N> UnrolledLinkedList<T, N>::end() const {
+  return UnrolledLinkedListIterator<T, N>(nullptr);
+}
+
+template <typename T, std::size_t N>
+const bool UnrolledLinkedList<T, N>::operator==(const UnrolledLinkedList& other) const {
+  if (this == &other) return true;
+  if (this->length != other.length) return false;
+  // Nodes of equal lists need not be filled alike, so compare the overlapping
+  // runs of the two current nodes.
+  const UnrolledNode<T, N>* current = this->head;
+  const UnrolledNode<T, N>* otherCurrent = other.head;
+  std::size_t offset = 0;
+  std::size_t otherOffset = 0;
+  while (current) {
+    const std::size_t run =
+        std::min(current->count - offset, otherCurrent->count - otherOffset);
+    if (!BlockSearch<T>::equal(current->elements() + offset,
+                               otherCurrent->elements() + otherOffset, run))
+      return false;
+    if ((offset += run) == current->count) {
+      current = current->next;
+      offset = 0;
+    }
+    if ((otherOffset += run) == otherCurrent->count) {
+      otherCurrent = otherCurrent->next;
+      otherOffset = 0;
+    }
+  }
+  return true;
+}
+
+template <typename T, std::size_t N>
+const bool UnrolledLinkedList<T, N>::operator!=(const UnrolledLinkedList& other) const {
+  return !this->operator==(other);
+}
+
+template <typename T, std::size_t N>
+const T& UnrolledLinkedList<T, N>::operator[](const std::size_t index) const {
+  if (index >= this->length) throw ListIndexOutOfBounds(index, this->length);
+  std::size_t offset = index;
+  return (*this->locate(offset))[offset];
+}
+
+template <typename T, std::size_t N>
+T& UnrolledLinkedList<T, N>::operator[](const std::size_t index) {
+  if (index >= this->length) throw ListIndexOutOfBounds(index, this->length);
+  std::size_t offset = index;
+  return (*this->locate(offset))[offset];
+}
+
+// Finds the node holding position `offset` and rewrites `offset` relative to
+// that node, reporting its predecessor through `prior` when asked. Positions
+// past the end resolve to the tail.
+template <typename T, std::size_t N>
+UnrolledNode<T, N>* UnrolledLinkedList<T, N>::locate(std::size_t& offset,
+                                                     UnrolledNode<T, N>** prior) const {
+  UnrolledNode<T, N>* previous = nullptr;
+  UnrolledNode<T, N>* current = this->head;
+  if (!prior && offset >= this->length - this->tail->count) {
+    offset -= this->length - this->tail->count;
+    return this->tail;
+  }
+  while (offset >= current->count && current->next) {
+    offset -= current->count;
+    previous = current;
+    current = current->next;
+  }
+  if (prior) *prior = previous;
+  return current;
+}
+
+template <typename T, std::size_t N>
+void UnrolledLinkedList<T, N>::insertAt(UnrolledNode<T, N>* node, std::size_t offset,
+                                        const T& data) {
+  T value(data);
+  if (node->count == N) {
+    this->split(node);
+    if (offset > node->count) {
+      offset -= node->count;
+      node = node->next;
+    }
+  }
+  T* elements = node->elements();
+  if (offset == node->count) {
+    new (elements + offset) T(std::move(value));
+  } else {
+    new (elements + node->count) T(std::move(elements[node->count - 1]));
+    for (std::size_t i = node->count - 1; i > offset; --i)
+      elements[i] = std::move(elements[i - 1]);
+    elements[offset] = std::move(value);
+  }
+  ++node->count;
+  ++this->length;
+}
+
+template <typename T, std::size_t N>
+T UnrolledLinkedList<T, N>::eraseAt(UnrolledNode<T, N>* prior, UnrolledNode<T, N>* node,
+                                    const std::size_t offset) {
+  T* elements = node->elements();
+  T data(std::move(elements[offset]));
+  for (std::size_t i = offset + 1; i < node->count; ++i)
+    elements[i - 1] = std::move(elements[i]);
+  elements[--node->count].~T();
+  --this->length;
+  if (node->count == 0)
+    this->unlink(prior, node);
+  else
+    this->rebalance(node);
+  return data;
+}
+
+// Moves the upper half of a full node into a fresh successor.
+template <typename T, std::size_t N>
+void UnrolledLinkedList<T, N>::split(UnrolledNode<T, N>* node) {
+  UnrolledNode<T, N>* fresh = new UnrolledNode<T, N>();
+  const std::size_t keep = (node->count + 1) / 2;
+  for (std::size_t i = keep; i < node->count; ++i) {
+    new (fresh->elements() + fresh->count++) T(std::move((*node)[i]));
+    (*node)[i].~T();
+  }
+  node->count = keep;
+  fresh->next = node->next;
+  node->next = fresh;
+  if (this->tail == node) this->tail = fresh;
+}
+
+template <typename T, std::size_t N>
+void UnrolledLinkedList<T, N>::mergeNext(UnrolledNode<T, N>* node) {
+  UnrolledNode<T, N>* next = node->next;
+  for (std::size_t i = 0; i < next->count; ++i) {
+    new (node->elements() + node->count++) T(std::move((*next)[i]));
+    (*next)[i].~T();
+  }
+  next->count = 0;
+  this->unlink(node, next);
+}
+
+// Brings a node with a successor back to N / 2 elements: merges the two when
+// they fit in one node, and otherwise moves the successor's first elements
+// over, which leaves it at least N / 2 too.
+template <typename T, std::size_t N>
+void UnrolledLinkedList<T, N>::rebalance(UnrolledNode<T, N>* node) {
+  UnrolledNode<T, N>* next = node->next;
+  if (!next || node->count >= N / 2) return;
+  if (node->count + next->count <= N) {
+    this->mergeNext(node);
+    return;
+  }
+  const std::size_t moved = N / 2 - node->count;
+  T* elements = next->elements();
+  for (std::size_t i = 0; i < moved; ++i)
+    new (node->elements() + node->count++) T(std::move(elements[i]));
+  for (std::size_t i = moved; i < next->count; ++i) elements[i - moved] = std::move(elements[i]);
+  for (std::size_t i = next->count - moved; i < next->count; ++i) elements[i].~T();
+  next->count -= moved;
+}
+
+template <typename T, std::size_t N>
+void UnrolledLinkedList<T, N>::unlink(UnrolledNode<T, N>* prior, UnrolledNode<T, N>* node) {
+  if (prior)
+    prior->next = node->next;
+  else
+    this->head = node->next;
+  if (this->tail == node) this->tail = prior;
+  this->destroyNode(node);
+}
+
+template <typename T, std::size_t N>
+void UnrolledLinkedList<T, N>::destroyNode(UnrolledNode<T, N>* node) {
+  for (std::size_t i = 0; i < node->count; ++i) (*node)[i].~T();
+  delete node;
+}
+
+#endif
@@ -0,0 +1,49 @@
+#ifndef UNROLLEDLINKEDLISTITERATOR_HPP
+#define UNROLLEDLINKEDLISTITERATOR_HPP
+
+#include <stddef.h>
+#include <iterator>
+#include "UnrolledNode.hpp"
+
+template <typename T, std::size_t N>
+class UnrolledLinkedListIterator {
+ public:
+  using iterator_category = std::forward_iterator_tag;
+  using value_type = T;
+  using difference_type = std::ptrdiff_t;
+  using pointer = T*;
+  using reference = T&;
+
+  UnrolledLinkedListIterator() : current(nullptr), offset(0) {}
+  UnrolledLinkedListIterator(UnrolledNode<T, N>* start)
+      : current(start), offset(0) {}
+  UnrolledLinkedListIterator<T, N>& operator++() {
+    if (++this->offset == this->current->count) {
+      this->current = this->current->next;
+      this->offset = 0;
+    }
+    return *this;
+  }
+  UnrolledLinkedListIterator<T, N> operator++(int) {
+    UnrolledLinkedListIterator<T, N> previous = *this;
+    this->operator++();
+    return previous;
+  }
+  T& operator*() const {
+    return (*this->current)[this->offset];
+  }
+  T* operator->() const {
+    return &(*this->current)[this->offset];
+  }
+  const bool operator==(const UnrolledLinkedListIterator<T, N>& other) const {
+    return this->current == other.current && this->offset == other.offset;
+  }
+  const bool operator!=(const UnrolledLinkedListIterator<T, N>& other) const {
+    return !this->operator==(other);
+  }
+ private:
+  UnrolledNode<T, N>* current;
+  std::size_t offset;
+};
+
+#endif
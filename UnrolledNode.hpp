@@ -0,0 +1,56 @@
+#ifndef UNROLLEDNODE_HPP
+#define UNROLLEDNODE_HPP
+
+#include <stddef.h>
+#include <ostream>
+
+// Node holding up to N elements inline. Only the first `count` slots of
+// `storage` hold constructed objects.
+template <typename T, std::size_t N>
+struct UnrolledNode {
+  static_assert(N > 0, "UnrolledNode needs room for at least one element");
+
+  std::size_t count;
+  UnrolledNode* next;
+  alignas(T) unsigned char storage[N * sizeof(T)];
+
+  UnrolledNode();
+
+  T* elements();
+  const T* elements() const;
+  T& operator[](const std::size_t);
+  const T& operator[](const std::size_t) const;
+
+  friend std::ostream& operator<<(std::ostream& output, const UnrolledNode& self) {
+    output << "Data: {";
+    for (std::size_t i = 0; i < self.count; ++i)
+      output << (i ? ", " : "") << self[i];
+    output << "} Next: " << self.next;
+    return output;
+  }
+};
+
+template <typename T, std::size_t N>
+UnrolledNode<T, N>::UnrolledNode() : count(0), next(nullptr) {}
+
+template <typename T, std::size_t N>
+T* UnrolledNode<T, N>::elements() {
+  return reinterpret_cast<T*>(this->storage);
+}
+
+template <typename T, std::size_t N>
+const T* UnrolledNode<T, N>::elements() const {
+  return reinterpret_cast<const T*>(this->storage);
+}
+
+template <typename T, std::size_t N>
+T& UnrolledNode<T, N>::operator[](const std::size_t index) {
+  return this->elements()[index];
+}
+
+template <typename T, std::size_t N>
+const T& UnrolledNode<T, N>::operator[](const std::size_t index) const {
+  return this->elements()[index];
+}
+
+#endif